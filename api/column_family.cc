@@ -13,6 +13,7 @@
 #include "api/api-doc/storage_service.json.hh"
 #include <vector>
 #include <seastar/http/exception.hh>
+#include <seastar/coroutine/maybe_yield.hh>
 #include "sstables/sstables.hh"
 #include "sstables/metadata_collector.hh"
 #include "utils/estimated_histogram.hh"
@@ -22,6 +23,7 @@
 #include "storage_service.hh"
 #include "compaction/compaction_manager.hh"
 #include "unimplemented.hh"
+#include "utils/rjson.hh"
 
 extern logging::logger apilog;
 
@@ -1113,6 +1115,74 @@ void set_column_family(http_context& ctx, routes& r, sharded<db::system_keyspace
         });
     });
 
+    cf::get_cache_hot_keys.set(r, [&ctx] (std::unique_ptr<http::request> req) -> future<json::json_return_type> {
+        auto uuid = get_uuid(req->get_path_param("name"), ctx.db.local());
+        api::req_param<unsigned> max_keys(*req, "max_keys", 1000);
+
+        // Keys are hex-encoded partition key representations, which don't
+        // depend on the key types and can be decoded on any shard.
+        auto keys = co_await ctx.db.map_reduce0([uuid, max_keys = max_keys.value] (replica::database& db) -> future<std::vector<sstring>> {
+            auto dks = co_await db.find_column_family(uuid).get_row_cache().hot_partition_keys(max_keys);
+            std::vector<sstring> keys;
+            keys.reserve(dks.size());
+            for (const auto& dk : dks) {
+                keys.push_back(to_hex(to_bytes(dk.key().representation())));
+                co_await coroutine::maybe_yield();
+            }
+            co_return keys;
+        }, std::vector<sstring>(), [] (std::vector<sstring> a, std::vector<sstring>&& b) {
+            std::move(b.begin(), b.end(), std::back_inserter(a));
+            return a;
+        });
+        co_return json::json_return_type(std::move(keys));
+    });
+
+    cf::populate_cache_hot_keys.set(r, [&ctx] (std::unique_ptr<http::request> req) -> future<json::json_return_type> {
+        auto uuid = get_uuid(req->get_path_param("name"), ctx.db.local());
+        auto schema = ctx.db.local().find_schema(uuid);
+
+        std::vector<partition_key> keys;
+        try {
+            auto doc = rjson::parse(req->content);
+            if (!doc.IsArray()) {
+                throw bad_param_exception("Expected a json array of keys");
+            }
+            for (const auto& v : doc.GetArray()) {
+                if (!v.IsString()) {
+                    throw bad_param_exception("Expected a json array of keys");
+                }
+                auto key = partition_key::from_bytes(from_hex(rjson::to_string_view(v)));
+                key.view().validate(*schema);
+                keys.push_back(std::move(key));
+            }
+        } catch (const bad_param_exception&) {
+            throw;
+        } catch (...) {
+            throw bad_param_exception(format("Invalid keys: {}", std::current_exception()));
+        }
+
+        apilog.info("populate_cache_hot_keys: table={}.{} keys={}", schema->ks_name(), schema->cf_name(), keys.size());
+
+        co_await ctx.db.invoke_on_all([uuid, &keys] (replica::database& db) -> future<> {
+            auto& t = db.find_column_family(uuid);
+            std::vector<dht::decorated_key> dks;
+            for (const auto& key : keys) {
+                auto dk = dht::decorate_key(*t.schema(), key);
+                if (t.shard_for_reads(dk.token()) == this_shard_id()) {
+                    dks.push_back(std::move(dk));
+                }
+                co_await coroutine::maybe_yield();
+            }
+            // The maintenance scheduling group and its reader concurrency
+            // semaphore pace the warm-up against user reads.
+            co_await with_scheduling_group(db.get_streaming_scheduling_group(), coroutine::lambda([&] () -> future<> {
+                auto permit = co_await db.obtain_reader_permit(t, "cache_warm_up", db::no_timeout, {});
+                co_await t.get_row_cache().populate_from_underlying(std::move(dks), std::move(permit));
+            }));
+        });
+        co_return json_void();
+    });
+
     cf::force_major_compaction.set(r, [&ctx](std::unique_ptr<http::request> req) -> future<json::json_return_type> {
         auto params = req_params({
             std::pair("name", mandatory::yes),
@@ -1254,6 +1324,8 @@ void unset_column_family(http_context& ctx, routes& r) {
     cf::get_sstable_count_per_level.unset(r);
     cf::get_sstables_for_key.unset(r);
     cf::toppartitions.unset(r);
+    cf::get_cache_hot_keys.unset(r);
+    cf::populate_cache_hot_keys.unset(r);
     cf::force_major_compaction.unset(r);
 }
 }
@@ -295,7 +295,7 @@ future<> cache_mutation_reader::process_static_row() {
 
 inline
 void cache_mutation_reader::touch_partition() {
-    _snp->touch();
+    _snp->touch(!table_schema().caching_options().low_priority());
 }
 
 inline
@@ -21,6 +21,7 @@
 #include <boost/range/join.hpp>
 #include <boost/algorithm/cxx11/any_of.hpp>
 #include <boost/algorithm/string/join.hpp>
+#include <boost/lexical_cast.hpp>
 
 #include <seastar/core/future-util.hh>
 #include <seastar/core/scheduling.hh>
@@ -1804,9 +1805,32 @@ static future<compaction_result> scrub_sstables_validate_mode(sstables::compacti
     for (const auto& sst : descriptor.sstables) {
         clogger.info("Scrubbing in validate mode {}", sst->get_filename());
 
-        validation_errors += co_await sst->validate(permit, cdata.abort, [&schema] (sstring what) {
-            scrub_compaction::report_validation_error(compaction_type::Scrub, *schema, what);
-        }, monitor_generator(sst));
+        // Check the per-chunk checksums and the full-file digest first. This
+        // reads the data file as stored on disk, without decompressing or
+        // parsing it. If they don't match, the sstable is corrupt and the
+        // content validation would only report the consequences of that.
+        bool checksums_valid = true;
+        if (sst->has_component(component_type::Digest)) {
+            try {
+                checksums_valid = co_await sstables::validate_checksums(sst, permit);
+                if (!checksums_valid) {
+                    scrub_compaction::report_validation_error(compaction_type::Scrub, *schema, format("checksum or digest mismatch in {}", sst->get_filename()));
+                }
+            } catch (const malformed_sstable_exception& e) {
+                scrub_compaction::report_validation_error(compaction_type::Scrub, *schema, format("unrecoverable error while validating checksums of {}: {}", sst->get_filename(), e));
+                checksums_valid = false;
+            } catch (const boost::bad_lexical_cast& e) {
+                scrub_compaction::report_validation_error(compaction_type::Scrub, *schema, format("invalid digest in {}: {}", sst->get_filename(), e.what()));
+                checksums_valid = false;
+            }
+        }
+        if (!checksums_valid) {
+            ++validation_errors;
+        } else if (!cdata.is_stop_requested()) {
+            validation_errors += co_await sst->validate(permit, cdata.abort, [&schema] (sstring what) {
+                scrub_compaction::report_validation_error(compaction_type::Scrub, *schema, what);
+            }, monitor_generator(sst));
+        }
         // Did validation actually finish because aborted?
         if (cdata.is_stop_requested()) {
             // Compaction manager will catch this exception and re-schedule the compaction.
@@ -61,6 +61,10 @@ std::map<sstring, sstring> compressor::options() const {
     return {};
 }
 
+bool compressor::uncompress_depends_on_options() const {
+    return !options().empty();
+}
+
 compressor::ptr_type compressor::create(const sstring& name, const opt_getter& opts) {
     if (name.empty()) {
         return {};
@@ -49,6 +49,12 @@ class compressor {
      * Returns original options used in instantiating this compressor
      */
     virtual std::map<sstring, sstring> options() const;
+    /**
+     * Whether uncompressing data needs a compressor created with the
+     * same options, rather than one created from the name alone.
+     * Assumed for every compressor which has options.
+     */
+    virtual bool uncompress_depends_on_options() const;
 
     /**
      * Compressor class name.
@@ -21,6 +21,8 @@
 #include "first_function.hh"
 #include "exceptions/exceptions.hh"
 #include "utils/multiprecision_int.hh"
+#include "utils/murmur_hash.hh"
+#include "sstables/hyperloglog.hh"
 #include <cstddef>
 #include <cstdint>
 #include <optional>
@@ -325,6 +327,64 @@ aggregate_fcts::make_count_function(data_type input_type) {
         });
 }
 
+// Register width of the approx_count_distinct() estimator: 2^11 registers
+// give a standard error of about 2.3%.
+static constexpr uint8_t approx_count_distinct_register_bits = 11;
+
+static bytes hll_to_bytes(const hll::HyperLogLog& hll) {
+    auto& registers = hll.registers();
+    return bytes(reinterpret_cast<const int8_t*>(registers.data()), registers.size());
+}
+
+static hll::HyperLogLog hll_from_bytes(bytes_view b) {
+    return hll::HyperLogLog::from_registers(std::span(reinterpret_cast<const uint8_t*>(b.data()), b.size()));
+}
+
+shared_ptr<aggregate_function>
+aggregate_fcts::make_approx_count_distinct_function(data_type input_type) {
+    input_type = input_type->without_reversed().shared_from_this();
+    return make_shared<db::functions::aggregate_function>(
+        db::functions::stateless_aggregate_function{
+            .name = function_name::native_function(APPROX_COUNT_DISTINCT_FUNCTION_NAME),
+            .state_type = bytes_type,
+            .result_type = long_type,
+            .argument_types = {input_type},
+            .initial_state = hll_to_bytes(hll::HyperLogLog(approx_count_distinct_register_bits)),
+            .aggregation_function = ::make_shared<internal_scalar_function>(
+                    "approx_count_distinct_step",
+                    bytes_type,
+                    std::vector<data_type>({bytes_type, input_type}),
+                    [] (std::span<const bytes_opt> args) {
+                        if (!args[1]) {
+                            return args[0];
+                        }
+                        // Only one register can change, so update it in a
+                        // copy of the state instead of decoding the state.
+                        bytes_opt state = args[0];
+                        std::array<uint64_t, 2> hash;
+                        utils::murmur_hash::hash3_x64_128(*args[1], 0, hash);
+                        hll::HyperLogLog::offer_hashed(std::span(reinterpret_cast<uint8_t*>(state->data()), state->size()), hash[0]);
+                        return state;
+                    }),
+            .state_to_result_function = ::make_shared<internal_scalar_function>(
+                    "approx_count_distinct_finalizer",
+                    long_type,
+                    std::vector<data_type>({bytes_type}),
+                    [] (std::span<const bytes_opt> args) {
+                        return data_value(int64_t(std::llround(hll_from_bytes(*args[0]).estimate()))).serialize();
+                    }),
+            .state_reduction_function = ::make_shared<internal_scalar_function>(
+                    "approx_count_distinct_reducer",
+                    bytes_type,
+                    std::vector<data_type>({bytes_type, bytes_type}),
+                    [] (std::span<const bytes_opt> args) {
+                        auto hll = hll_from_bytes(*args[0]);
+                        hll.merge(hll_from_bytes(*args[1]));
+                        return bytes_opt(hll_to_bytes(hll));
+                    }),
+        });
+}
+
 // Drops the first arg type from the types declaration (which denotes the accumulator)
 // in order to compute the actual type of given user-defined-aggregate (UDA)
 static std::vector<data_type> state_arg_types_to_uda_arg_types(const std::vector<data_type>& arg_types) {
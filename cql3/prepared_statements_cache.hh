@@ -56,8 +56,7 @@ class prepared_cache_key_type {
     bool operator==(const prepared_cache_key_type& other) const = default;
 };
 
-class prepared_statements_cache {
-public:
+struct prepared_cache_stats_updater {
     struct stats {
         uint64_t prepared_cache_evictions = 0;
         uint64_t privileged_entries_evictions_on_size = 0;
@@ -69,21 +68,57 @@ class prepared_statements_cache {
         return _stats;
     }
 
-    struct prepared_cache_stats_updater {
-        static void inc_hits() noexcept {}
-        static void inc_misses() noexcept {}
-        static void inc_blocks() noexcept {}
-        static void inc_evictions() noexcept {
-            ++shard_stats().prepared_cache_evictions;
-        }
-        static void inc_privileged_on_cache_size_eviction() noexcept {
-            ++shard_stats().privileged_entries_evictions_on_size;
-        }
-        static void inc_unprivileged_on_cache_size_eviction() noexcept {
-            ++shard_stats().unprivileged_entries_evictions_on_size;
-        }
+    static void inc_hits() noexcept {}
+    static void inc_misses() noexcept {}
+    static void inc_blocks() noexcept {}
+    static void inc_evictions() noexcept {
+        ++shard_stats().prepared_cache_evictions;
+    }
+    static void inc_privileged_on_cache_size_eviction() noexcept {
+        ++shard_stats().privileged_entries_evictions_on_size;
+    }
+    static void inc_unprivileged_on_cache_size_eviction() noexcept {
+        ++shard_stats().unprivileged_entries_evictions_on_size;
+    }
+};
+
+// Counts the statements cached for unprepared queries apart from prepared
+// statements, so that ad-hoc queries don't show up in the prepared cache metrics.
+struct unprepared_cache_stats_updater {
+    struct stats {
+        // Counted by query_processor, which looks statements up with find()
+        // before loading them.
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+        uint64_t evictions = 0;
     };
 
+    static stats& shard_stats() {
+        static thread_local stats _stats;
+        return _stats;
+    }
+
+    static void inc_hits() noexcept {}
+    static void inc_misses() noexcept {
+        ++shard_stats().misses;
+    }
+    static void inc_blocks() noexcept {}
+    static void inc_evictions() noexcept {
+        ++shard_stats().evictions;
+    }
+    static void inc_privileged_on_cache_size_eviction() noexcept {}
+    static void inc_unprivileged_on_cache_size_eviction() noexcept {}
+};
+
+template <typename StatsUpdater>
+class basic_prepared_statements_cache {
+public:
+    using stats = typename StatsUpdater::stats;
+
+    static stats& shard_stats() {
+        return StatsUpdater::shard_stats();
+    }
+
 private:
     using cache_key_type = typename prepared_cache_key_type::cache_key_type;
     // Keep the entry in the "unprivileged" cache section till 2 hits because
@@ -93,12 +128,12 @@ class prepared_statements_cache {
     //
     // Therefore a typical "pollution" (when a cache entry is used only once) would involve
     // 2 cache hits.
-    using cache_type = utils::loading_cache<cache_key_type, prepared_cache_entry, 2, utils::loading_cache_reload_enabled::no, prepared_cache_entry_size, std::hash<cache_key_type>, std::equal_to<cache_key_type>, prepared_cache_stats_updater, prepared_cache_stats_updater>;
+    using cache_type = utils::loading_cache<cache_key_type, prepared_cache_entry, 2, utils::loading_cache_reload_enabled::no, prepared_cache_entry_size, std::hash<cache_key_type>, std::equal_to<cache_key_type>, StatsUpdater, StatsUpdater>;
     using cache_value_ptr = typename cache_type::value_ptr;
     using checked_weak_ptr = typename statements::prepared_statement::checked_weak_ptr;
 
 public:
-    static const std::chrono::minutes entry_expiry;
+    static constexpr std::chrono::minutes entry_expiry{60};
 
     using key_type = prepared_cache_key_type;
     using value_type = checked_weak_ptr;
@@ -108,7 +143,7 @@ class prepared_statements_cache {
     cache_type _cache;
 
 public:
-    prepared_statements_cache(logging::logger& logger, size_t size)
+    basic_prepared_statements_cache(logging::logger& logger, size_t size)
         : _cache(size, entry_expiry, logger)
     {}
 
@@ -153,6 +188,9 @@ class prepared_statements_cache {
         return _cache.stop();
     }
 };
+
+using prepared_statements_cache = basic_prepared_statements_cache<prepared_cache_stats_updater>;
+using unprepared_statements_cache = basic_prepared_statements_cache<unprepared_cache_stats_updater>;
 }
 
 namespace std {
@@ -42,8 +42,6 @@ logging::logger authorized_prepared_statements_cache_log("authorized_prepared_st
 
 const sstring query_processor::CQL_VERSION = "3.3.1";
 
-const std::chrono::minutes prepared_statements_cache::entry_expiry = std::chrono::minutes(60);
-
 struct query_processor::remote {
     remote(service::migration_manager& mm, service::mapreduce_service& fwd,
            service::storage_service& ss, service::raft_group0_client& group0_client)
@@ -80,6 +78,10 @@ query_processor::query_processor(service::storage_proxy& proxy, data_dictionary:
         , _authorized_prepared_cache_validity_in_ms_observer(_db.get_config().permissions_validity_in_ms.observe(_auth_prepared_cache_cfg_cb))
         , _lang_manager(langm)
         {
+    if (_mcfg.unprepared_statement_cache_size) {
+        _unprepared_cache.emplace(prep_cache_log, _mcfg.unprepared_statement_cache_size);
+    }
+
     namespace sm = seastar::metrics;
     namespace stm = statements;
     using clevel = db::consistency_level;
@@ -345,6 +347,26 @@ query_processor::query_processor(service::storage_proxy& proxy, data_dictionary:
                             [this] { return _prepared_cache.memory_footprint(); },
                             sm::description("Size (in bytes) of the prepared statements cache.")),
 
+                    sm::make_counter(
+                            "unprepared_cache_hits",
+                            [] { return unprepared_statements_cache::shard_stats().hits; },
+                            sm::description("Counts the number of unprepared queries whose statement was found in the unprepared statements cache.")),
+
+                    sm::make_counter(
+                            "unprepared_cache_misses",
+                            [] { return unprepared_statements_cache::shard_stats().misses; },
+                            sm::description("Counts the number of unprepared queries whose statement was parsed and added to the unprepared statements cache.")),
+
+                    sm::make_counter(
+                            "unprepared_cache_evictions",
+                            [] { return unprepared_statements_cache::shard_stats().evictions; },
+                            sm::description("Counts the number of unprepared statements cache entries evictions.")),
+
+                    sm::make_gauge(
+                            "unprepared_cache_size",
+                            [this] { return _unprepared_cache ? _unprepared_cache->size() : 0; },
+                            sm::description("A number of entries in the unprepared statements cache.")),
+
                     sm::make_counter(
                             "secondary_index_creates",
                             _cql_stats.secondary_index_creates,
@@ -524,6 +546,9 @@ future<> query_processor::stop() {
     co_await _mnotifier.unregister_listener(_migration_subscriber.get());
     co_await _authorized_prepared_cache.stop();
     co_await _prepared_cache.stop();
+    if (_unprepared_cache) {
+        co_await _unprepared_cache->stop();
+    }
 }
 
 future<::shared_ptr<cql_transport::messages::result_message>> query_processor::execute_with_guard(
@@ -569,16 +594,35 @@ future<::shared_ptr<result_message>>
 query_processor::execute_direct_without_checking_exception_message(const sstring_view& query_string, service::query_state& query_state, query_options& options) {
     log.trace("execute_direct: \"{}\"", query_string);
     tracing::trace(query_state.get_trace_state(), "Parsing a statement");
-    auto p = get_statement(query_string, query_state.get_client_state());
-    auto statement = p->statement;
-    const auto warnings = std::move(p->warnings);
+    if (_unprepared_cache) {
+        auto& client_state = query_state.get_client_state();
+        auto key = compute_id(query_string, client_state.get_raw_keyspace());
+        if (auto p = _unprepared_cache->find(key)) {
+            ++unprepared_statements_cache::shard_stats().hits;
+            return execute_direct_statement(*p, query_state, options);
+        }
+        return _unprepared_cache->get(key, [this, query_string = sstring(query_string), &client_state] {
+            return make_ready_future<std::unique_ptr<statements::prepared_statement>>(get_statement(query_string, client_state));
+        }).then([this, &query_state, &options] (statements::prepared_statement::checked_weak_ptr p) {
+            return execute_direct_statement(*p, query_state, options);
+        }).handle_exception_type([this, query_string = sstring(query_string), &query_state, &options] (unprepared_statements_cache::statement_is_too_big&) {
+            return execute_direct_statement(*get_statement(query_string, query_state.get_client_state()), query_state, options);
+        });
+    }
+    return execute_direct_statement(*get_statement(query_string, query_state.get_client_state()), query_state, options);
+}
+
+future<::shared_ptr<result_message>>
+query_processor::execute_direct_statement(const statements::prepared_statement& p, service::query_state& query_state, query_options& options) {
+    auto statement = p.statement;
+    auto warnings = p.warnings;
     if (statement->get_bound_terms() != options.get_values_count()) {
         const auto msg = format("Invalid amount of bind variables: expected {:d} received {:d}",
                 statement->get_bound_terms(),
                 options.get_values_count());
         throw exceptions::invalid_request_exception(msg);
     }
-    options.prepare(p->bound_names);
+    options.prepare(p.bound_names);
 
     warn(unimplemented::cause::METRICS);
 #if 0
@@ -1133,6 +1177,11 @@ void query_processor::migration_subscriber::remove_invalid_prepared_statements(
     _qp->_prepared_cache.remove_if([&] (::shared_ptr<cql_statement> stmt) {
         return this->should_invalidate(ks_name, cf_name, stmt);
     });
+    if (_qp->_unprepared_cache) {
+        _qp->_unprepared_cache->remove_if([&] (::shared_ptr<cql_statement> stmt) {
+            return this->should_invalidate(ks_name, cf_name, stmt);
+        });
+    }
 }
 
 bool query_processor::migration_subscriber::should_invalidate(
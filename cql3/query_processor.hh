@@ -97,6 +97,8 @@ class query_processor : public seastar::peering_sharded_service<query_processor>
     struct memory_config {
         size_t prepared_statment_cache_size = 0;
         size_t authorized_prepared_cache_size = 0;
+        // Zero disables caching of unprepared statements.
+        size_t unprepared_statement_cache_size = 0;
     };
 
 private:
@@ -120,6 +122,11 @@ class query_processor : public seastar::peering_sharded_service<query_processor>
     seastar::metrics::metric_groups _metrics;
 
     prepared_statements_cache _prepared_cache;
+    // Statements of QUERY messages, keyed by their text and keyspace the same
+    // way as _prepared_cache, so that repeated identical queries are parsed once.
+    // Kept apart from _prepared_cache so ad-hoc queries cannot evict
+    // statements clients prepared.
+    std::optional<unprepared_statements_cache> _unprepared_cache;
     authorized_prepared_statements_cache _authorized_prepared_cache;
 
     std::function<void(uint32_t)> _auth_prepared_cache_cfg_cb;
@@ -265,6 +272,12 @@ class query_processor : public seastar::peering_sharded_service<query_processor>
             service::query_state& query_state,
             query_options& options);
 
+    future<::shared_ptr<cql_transport::messages::result_message>>
+    execute_direct_statement(
+            const statements::prepared_statement& p,
+            service::query_state& query_state,
+            query_options& options);
+
     future<::shared_ptr<cql_transport::messages::result_message>>
     do_execute_direct(
             service::query_state& query_state,
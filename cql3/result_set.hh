@@ -42,6 +42,11 @@ class metadata {
     // (CASSANDRA-4911). So the serialization code will exclude any columns in name whose index is >= columnCount.
         std::vector<lw_shared_ptr<column_specification>> _names;
         uint32_t _column_count;
+        // The native protocol encoding of the first _column_count names,
+        // filled in by the CQL server on first use. column_info is shared by
+        // all results of a statement, so later results reuse it.
+        mutable bytes_opt _serialized_names;
+        mutable bool _serialized_with_global_tables_spec = false;
 
         column_info(std::vector<lw_shared_ptr<column_specification>> names, uint32_t column_count)
             : _names(std::move(names))
@@ -89,6 +94,17 @@ class metadata {
     const std::vector<lw_shared_ptr<column_specification>>& get_names() const {
         return _column_info->_names;
     }
+
+    // Cached native protocol encoding of the column specifications, if the
+    // CQL server already produced it with the given global_tables_spec.
+    const bytes_opt& serialized_names(bool global_tables_spec) const {
+        static const bytes_opt none;
+        return _column_info->_serialized_with_global_tables_spec == global_tables_spec ? _column_info->_serialized_names : none;
+    }
+    void set_serialized_names(bool global_tables_spec, bytes serialized) const {
+        _column_info->_serialized_names = std::move(serialized);
+        _column_info->_serialized_with_global_tables_spec = global_tables_spec;
+    }
 };
 
 ::shared_ptr<const cql3::metadata> make_empty_metadata();
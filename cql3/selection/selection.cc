@@ -638,17 +638,24 @@ bool result_set_builder::restrictions_filter::do_filter(const selection& selecti
         return false;
     }
 
+    // The values of static and regular columns are only extracted from the
+    // row once, and only if some restriction needs them.
+    std::optional<std::vector<managed_bytes_opt>> static_and_regular_columns;
+    auto get_static_and_regular_columns = [&] () -> const std::vector<managed_bytes_opt>& {
+        if (!static_and_regular_columns) {
+            static_and_regular_columns = expr::get_non_pk_values(selection, static_row, row);
+        }
+        return *static_and_regular_columns;
+    };
+
     const expr::expression& clustering_columns_restrictions = _restrictions->get_clustering_columns_restrictions();
     if (expr::contains_multi_column_restriction(clustering_columns_restrictions)) {
-        clustering_key_prefix ckey = clustering_key_prefix::from_exploded(clustering_key);
-        // FIXME: push to upper layer so it happens once per row
-        auto static_and_regular_columns = expr::get_non_pk_values(selection, static_row, row);
         bool multi_col_clustering_satisfied = expr::is_satisfied_by(
                 clustering_columns_restrictions,
                 expr::evaluation_inputs{
                     .partition_key = partition_key,
                     .clustering_key = clustering_key,
-                    .static_and_regular_columns = static_and_regular_columns,
+                    .static_and_regular_columns = get_static_and_regular_columns(),
                     .selection = &selection,
                     .options = &_options,
                 });
@@ -657,15 +664,13 @@ bool result_set_builder::restrictions_filter::do_filter(const selection& selecti
         }
     }
 
-    auto static_row_iterator = static_row.iterator();
-    auto row_iterator = row ? std::optional<query::result_row_view::iterator_type>(row->iterator()) : std::nullopt;
     const expr::single_column_restrictions_map& non_pk_restrictions_map = _restrictions->get_non_pk_restriction();
     for (auto&& cdef : selection.get_columns()) {
         switch (cdef->kind) {
         case column_kind::static_column:
             // fallthrough
         case column_kind::regular_column: {
-            if (cdef->kind == column_kind::regular_column && !row_iterator) {
+            if (cdef->kind == column_kind::regular_column && !row) {
                 continue;
             }
             auto restr_it = non_pk_restrictions_map.find(cdef);
@@ -673,14 +678,12 @@ bool result_set_builder::restrictions_filter::do_filter(const selection& selecti
                 continue;
             }
             const expr::expression& single_col_restriction = restr_it->second;
-            // FIXME: push to upper layer so it happens once per row
-            auto static_and_regular_columns = expr::get_non_pk_values(selection, static_row, row);
             bool regular_restriction_matches = expr::is_satisfied_by(
                     single_col_restriction,
                     expr::evaluation_inputs{
                         .partition_key = partition_key,
                         .clustering_key = clustering_key,
-                        .static_and_regular_columns = static_and_regular_columns,
+                        .static_and_regular_columns = get_static_and_regular_columns(),
                         .selection = &selection,
                         .options = &_options,
                     });
@@ -691,10 +694,13 @@ bool result_set_builder::restrictions_filter::do_filter(const selection& selecti
             }
             break;
         case column_kind::partition_key: {
-            if (_skip_pk_restrictions) {
+            // All rows of a partition share its key, so it only needs to be
+            // checked for the first one.
+            if (_skip_pk_restrictions || _current_partition_key_matches) {
                 continue;
             }
-            auto partition_key_restrictions_map = _restrictions->get_single_column_partition_key_restrictions();
+            const expr::single_column_restrictions_map& partition_key_restrictions_map =
+                _restrictions->get_single_column_partition_key_restrictions();
             auto restr_it = partition_key_restrictions_map.find(cdef);
             if (restr_it == partition_key_restrictions_map.end()) {
                 continue;
@@ -745,6 +751,7 @@ bool result_set_builder::restrictions_filter::do_filter(const selection& selecti
             break;
         }
     }
+    _current_partition_key_matches = true;
     return true;
 }
 
@@ -769,6 +776,7 @@ bool result_set_builder::restrictions_filter::operator()(const selection& select
 
 void result_set_builder::restrictions_filter::reset(const partition_key* key) {
     _current_partition_key_does_not_match = false;
+    _current_partition_key_matches = false;
     _current_static_row_does_not_match = false;
     _rows_dropped = 0;
     _per_partition_remaining = _per_partition_limit;
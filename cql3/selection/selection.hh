@@ -209,6 +209,7 @@ class result_set_builder {
         const bool _skip_pk_restrictions;
         const bool _skip_ck_restrictions;
         mutable bool _current_partition_key_does_not_match = false;
+        mutable bool _current_partition_key_matches = false;
         mutable bool _current_static_row_does_not_match = false;
         mutable uint64_t _rows_dropped = 0;
         mutable uint64_t _remaining;
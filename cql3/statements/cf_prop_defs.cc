@@ -129,6 +129,14 @@ void cf_prop_defs::validate(const data_dictionary::database db, sstring ks_name,
         throw exceptions::configuration_exception("Per-partition rate limit is not supported yet by the whole cluster");
     }
 
+    auto caching_options = get_caching_options();
+    if (caching_options && caching_options->admit_frequent_only() && !db.features().cache_admission_option) {
+        throw exceptions::configuration_exception("The 'admission' caching option is not supported yet by the whole cluster");
+    }
+    if (caching_options && caching_options->low_priority() && !db.features().cache_priority_option) {
+        throw exceptions::configuration_exception("The 'priority' caching option is not supported yet by the whole cluster");
+    }
+
     auto tombstone_gc_options = get_tombstone_gc_options(schema_extensions);
     validate_tombstone_gc_options(tombstone_gc_options, db, ks_name);
 
@@ -21,6 +21,7 @@
 #include "service/broadcast_tables/experimental/lang.hh"
 #include "transport/messages/result_message.hh"
 #include "cql3/functions/as_json_function.hh"
+#include "cql3/functions/aggregate_fcts.hh"
 #include "cql3/selection/selection.hh"
 #include "cql3/util.hh"
 #include "cql3/restrictions/statement_restrictions.hh"
@@ -737,20 +738,40 @@ indexed_table_select_statement::do_execute_base_query(
         }
         next_iteration_size = std::min<size_t>({next_iteration_size, keys.size() - already_done, max_base_table_query_concurrency});
         auto key_it_end = key_it + next_iteration_size;
-        auto command = ::make_lw_shared<query::read_command>(*cmd);
+
+        // Keys of the same base partition come one after another, so each
+        // group of them is fetched with a single read of all the needed rows.
+        std::vector<std::pair<std::vector<primary_key>::iterator, std::vector<primary_key>::iterator>> partitions;
+        for (auto it = key_it; it != key_it_end; ) {
+            auto partition_end = std::find_if(std::next(it), key_it_end, [&] (const primary_key& key) {
+                return !key.partition.equal(*_schema, it->partition);
+            });
+            partitions.emplace_back(it, partition_end);
+            it = partition_end;
+        }
 
         query::result_merger oneshot_merger(cmd->get_row_limit(), query::max_partitions);
-        coordinator_result<foreign_ptr<lw_shared_ptr<query::result>>> rresult = co_await utils::result_map_reduce(key_it, key_it_end, coroutine::lambda([&] (auto& key)
+        coordinator_result<foreign_ptr<lw_shared_ptr<query::result>>> rresult = co_await utils::result_map_reduce(partitions.begin(), partitions.end(), coroutine::lambda([&] (auto& partition)
                 -> future<coordinator_result<foreign_ptr<lw_shared_ptr<query::result>>>> {
             auto command = ::make_lw_shared<query::read_command>(*cmd);
-            // for each partition, read just one clustering row (TODO: can
-            // get all needed rows of one partition at once.)
-            command->slice._row_ranges.clear();
-            if (key.clustering) {
-                command->slice._row_ranges.push_back(query::clustering_range::make_singular(key.clustering));
+            auto& row_ranges = command->slice._row_ranges;
+            row_ranges.clear();
+            for (auto it = partition.first; it != partition.second; ++it) {
+                if (it->clustering) {
+                    row_ranges.push_back(query::clustering_range::make_singular(it->clustering));
+                }
+            }
+            if (row_ranges.size() > 1) {
+                auto comparer = position_in_partition::less_compare(*_schema);
+                std::sort(row_ranges.begin(), row_ranges.end(), [&comparer] (const query::clustering_range& lhs, const query::clustering_range& rhs) {
+                    return comparer(position_in_partition_view::for_range_start(lhs), position_in_partition_view::for_range_start(rhs));
+                });
+                if (_is_reversed) {
+                    std::reverse(row_ranges.begin(), row_ranges.end());
+                }
             }
             coordinator_result<service::storage_proxy::coordinator_query_result> rqr
-                    = co_await qp.proxy().query_result(_schema, command, {dht::partition_range::make_singular(key.partition)}, options.get_consistency(), {timeout, state.get_permit(), state.get_client_state(), state.get_trace_state()});
+                    = co_await qp.proxy().query_result(_schema, command, {dht::partition_range::make_singular(partition.first->partition)}, options.get_consistency(), {timeout, state.get_permit(), state.get_client_state(), state.get_trace_state()});
             if (!rqr.has_value()) {
                 co_return std::move(rqr).as_failure();
             }
@@ -2020,6 +2041,16 @@ std::unique_ptr<prepared_statement> select_statement::prepare(data_dictionary::d
                 == locator::replication_strategy_type::local;
     };
 
+    // Nodes which don't know approx_count_distinct() cannot execute it on
+    // behalf of a mapreduce coordinator.
+    auto uses_unsupported_aggregates = [&] {
+        static const auto approx_count_distinct_name = functions::function_name::native_function(functions::aggregate_fcts::APPROX_COUNT_DISTINCT_FUNCTION_NAME);
+        return !db.features().approx_count_distinct_aggregate
+            && std::ranges::any_of(selection->used_functions(), [] (const shared_ptr<functions::function>& f) {
+                return f->name() == approx_count_distinct_name;
+            });
+    };
+
     // Used to determine if an execution of this statement can be parallelized
     // using `mapreduce_service`.
     auto can_be_mapreduced = [&] {
@@ -2029,6 +2060,7 @@ std::unique_ptr<prepared_statement> select_statement::prepare(data_dictionary::d
                 (db.features().parallelized_aggregation && selection->is_count())
                 || (db.features().uda_native_parallelized_aggregation && selection->is_reducible())
             )
+            && !uses_unsupported_aggregates()
             && !restrictions->need_filtering()  // No filtering
             && group_by_cell_indices->empty()   // No GROUP BY
             && db.get_config().enable_parallelized_aggregation()
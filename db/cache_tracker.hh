@@ -14,6 +14,7 @@
 #include "mutation/partition_version.hh"
 #include "mutation/mutation_cleaner.hh"
 #include "utils/cached_file_stats.hh"
+#include "utils/frequency_sketch.hh"
 #include "sstables/partition_index_cache_stats.hh"
 
 #include <seastar/core/metrics_registration.hh>
@@ -73,6 +74,7 @@ class cache_tracker final {
         uint64_t row_tombstone_reads;
         uint64_t rows_compacted;
         uint64_t rows_compacted_away;
+        uint64_t partitions_not_admitted;
 
         uint64_t active_reads() const {
             return reads - reads_done;
@@ -89,6 +91,9 @@ class cache_tracker final {
     mutation_cleaner _memtable_cleaner;
     mutation_application_stats& _app_stats;
     utils::updateable_value<double> _index_cache_fraction;
+    // Recent partition accesses of tables which only admit frequently read
+    // partitions, see caching_options::admit_frequent_only().
+    utils::frequency_sketch _admission_sketch;
 private:
     void setup_metrics();
 public:
@@ -98,7 +103,9 @@ class cache_tracker final {
     cache_tracker();
     ~cache_tracker();
     void clear();
-    void touch(rows_entry&);
+    // When refresh is false, an entry which is already in the LRU keeps its
+    // position, see caching_options::low_priority().
+    void touch(rows_entry&, bool refresh = true);
     void insert(cache_entry&);
     void insert(partition_entry&) noexcept;
     void insert(partition_version&) noexcept;
@@ -119,6 +126,11 @@ class cache_tracker final {
     void on_row_miss() noexcept;
     void on_miss_already_populated() noexcept;
     void on_mispopulate() noexcept;
+    // Records an access to the partition identified by key.
+    void on_partition_access(uint64_t key) noexcept { _admission_sketch.increment(key); }
+    // Records a missed access to the partition identified by key, and tells
+    // whether the partition was accessed recently enough to be worth caching.
+    bool admit_partition(uint64_t key) noexcept;
     void on_row_processed_from_memtable() noexcept { ++_stats.rows_processed_from_memtable; }
     void on_row_dropped_from_memtable() noexcept { ++_stats.rows_dropped_from_memtable; }
     void on_row_merged_from_memtable() noexcept { ++_stats.rows_merged_from_memtable; }
@@ -110,6 +110,10 @@ class commitlog {
         bool use_o_dsync = false;
         bool warn_about_segments_left_on_disk_after_shutdown = true;
         bool allow_going_over_size_limit = true;
+        // Whether entries may carry compressed mutations (see
+        // commitlog_entry). Segments are then written as segment_version_4,
+        // which older versions refuse to replay.
+        bool allow_compressed_entries = false;
 
         // The base segment ID to use.
         // The segment IDs of newly allocated segments will be issued sequentially
@@ -135,6 +139,10 @@ class commitlog {
         static inline constexpr uint32_t segment_version_1 = 1u;
         static inline constexpr uint32_t segment_version_2 = 2u;
         static inline constexpr uint32_t segment_version_3 = 3u;
+        // Same format as segment_version_3, but entries may carry compressed
+        // mutations, which a reader not knowing about them would replay as
+        // empty writes.
+        static inline constexpr uint32_t segment_version_4 = 4u;
         static inline constexpr uint32_t current_version = segment_version_3;
 
         descriptor(descriptor&&) noexcept = default;
@@ -7,6 +7,7 @@
  */
 
 #include "counters.hh"
+#include "mutation/mutation.hh"
 #include "commitlog_entry.hh"
 #include "idl/commitlog.dist.hh"
 #include "idl/commitlog.dist.impl.hh"
@@ -15,13 +16,55 @@
 
 template<typename Output>
 void commitlog_entry_writer::serialize(Output& out) const {
-    [this, wr = ser::writer_of_commitlog_entry<Output>(out)] () mutable {
+    auto wr = [this, wr = ser::writer_of_commitlog_entry<Output>(out)] () mutable {
         if (_with_schema) {
             return std::move(wr).write_mapping(_schema->get_column_mapping());
         } else {
             return std::move(wr).skip_mapping();
         }
-    }().write_mutation(_mutation).end_commitlog_entry();
+    }();
+    if (_compressed) {
+        std::move(wr).write_mutation(*_key_only).write_compressed_mutation(*_compressed).end_commitlog_entry();
+    } else {
+        std::move(wr).write_mutation(_mutation).skip_compressed_mutation().end_commitlog_entry();
+    }
+}
+
+void commitlog_entry_writer::compress(const compressor& c) {
+    auto& in = _mutation.representation();
+    commitlog_compressed_mutation cm{c.name(), uint32_t(in.size()), uint32_t(compressed_chunk_size), {}};
+    cm.chunks.reserve((in.size() + compressed_chunk_size - 1) / compressed_chunk_size);
+    bytes input(bytes::initialized_later(), std::min(in.size(), compressed_chunk_size));
+    bytes output(bytes::initialized_later(), c.compress_max_size(input.size()));
+    size_t filled = 0;
+    size_t compressed_size = 0;
+    auto compress_chunk = [&] {
+        auto len = c.compress(reinterpret_cast<const char*>(input.data()), filled,
+                reinterpret_cast<char*>(output.data()), output.size());
+        cm.chunks.emplace_back(output.data(), len);
+        compressed_size += len;
+        filled = 0;
+    };
+    for (bytes_view frag : in) {
+        while (!frag.empty()) {
+            auto n = std::min(frag.size(), input.size() - filled);
+            std::copy_n(frag.begin(), n, input.begin() + filled);
+            filled += n;
+            frag.remove_prefix(n);
+            if (filled == input.size()) {
+                compress_chunk();
+            }
+        }
+    }
+    if (filled) {
+        compress_chunk();
+    }
+    // Not worth the cpu on replay unless it saves at least an eighth.
+    if (compressed_size > in.size() - in.size() / 8) {
+        return;
+    }
+    _key_only.emplace(freeze(mutation(_schema, _mutation.key())));
+    _compressed.emplace(std::move(cm));
 }
 
 void commitlog_entry_writer::compute_size() {
@@ -34,10 +77,48 @@ void commitlog_entry_writer::write(ostream& out) const {
     serialize(out);
 }
 
+static const compressor& get_compressor(const sstring& name) {
+    static thread_local std::unordered_map<sstring, compressor_ptr> compressors;
+    auto i = compressors.find(name);
+    if (i == compressors.end()) {
+        auto c = compressor::create(name, [] (const sstring&) { return compressor::opt_string(); });
+        if (!c) {
+            throw std::runtime_error(format("Unknown compressor {} in commitlog entry", name));
+        }
+        i = compressors.emplace(name, std::move(c)).first;
+    }
+    return *i->second;
+}
+
+static commitlog_entry decompress(commitlog_entry ce) {
+    auto& cm = *ce.compressed_mutation();
+    auto& c = get_compressor(cm.compressor);
+    bytes_ostream out;
+    size_t left = cm.size;
+    for (const auto& chunk : cm.chunks) {
+        auto chunk_size = std::min<size_t>(left, cm.chunk_size);
+        auto out_frag = out.write_place_holder(chunk_size);
+        auto len = c.uncompress(reinterpret_cast<const char*>(chunk.data()), chunk.size(), reinterpret_cast<char*>(out_frag), chunk_size);
+        if (len != chunk_size) {
+            throw std::runtime_error(format("Commitlog entry chunk decompressed to {} bytes, expected {}", len, chunk_size));
+        }
+        left -= chunk_size;
+    }
+    if (left) {
+        throw std::runtime_error(format("Commitlog entry decompressed to {} bytes, expected {}", cm.size - left, cm.size));
+    }
+    partition_key key = ce.mutation().key();
+    return commitlog_entry(ce.mapping(), frozen_mutation(std::move(out), std::move(key)));
+}
+
 commitlog_entry_reader::commitlog_entry_reader(const fragmented_temporary_buffer& buffer)
     : _ce([&] {
     auto in = seastar::fragmented_memory_input_stream(fragmented_temporary_buffer::view(buffer).begin(), buffer.size_bytes());
-    return ser::deserialize(in, boost::type<commitlog_entry>());
+    auto ce = ser::deserialize(in, boost::type<commitlog_entry>());
+    if (ce.compressed_mutation()) {
+        return decompress(std::move(ce));
+    }
+    return ce;
 }())
 {
 }
@@ -11,6 +11,7 @@
 #include <optional>
 
 #include "commitlog_types.hh"
+#include "compress.hh"
 #include "mutation/frozen_mutation.hh"
 #include "schema/schema_fwd.hh"
 #include "replay_position.hh"
@@ -70,15 +71,30 @@ namespace detail {
     };
 }
 
+// The representation of a frozen mutation, compressed with the named compressor.
+// It is compressed in independent chunks of chunk_size bytes (the last one
+// may be shorter), so that large mutations don't need large contiguous
+// buffers.
+struct commitlog_compressed_mutation {
+    sstring compressor;
+    uint32_t size; // uncompressed
+    uint32_t chunk_size; // uncompressed
+    std::vector<bytes> chunks;
+};
+
 class commitlog_entry {
     std::optional<column_mapping> _mapping;
     frozen_mutation _mutation;
+    // When set, _mutation only carries the key and schema version, and the
+    // actual mutation is stored here.
+    std::optional<commitlog_compressed_mutation> _compressed_mutation;
 public:
-    commitlog_entry(std::optional<column_mapping> mapping, frozen_mutation&& mutation)
-        : _mapping(std::move(mapping)), _mutation(std::move(mutation)) { }
+    commitlog_entry(std::optional<column_mapping> mapping, frozen_mutation&& mutation, std::optional<commitlog_compressed_mutation> compressed_mutation = std::nullopt)
+        : _mapping(std::move(mapping)), _mutation(std::move(mutation)), _compressed_mutation(std::move(compressed_mutation)) { }
     const std::optional<column_mapping>& mapping() const { return _mapping; }
     const frozen_mutation& mutation() const & { return _mutation; }
     frozen_mutation&& mutation() && { return std::move(_mutation); }
+    const std::optional<commitlog_compressed_mutation>& compressed_mutation() const { return _compressed_mutation; }
 };
 
 class commitlog_entry_writer {
@@ -90,14 +106,31 @@ class commitlog_entry_writer {
     bool _with_schema = true;
     size_t _size = std::numeric_limits<size_t>::max();
     force_sync _sync;
+    // Set when the mutation is written compressed. _key_only is then what
+    // goes into the mutation field of the entry.
+    std::optional<frozen_mutation> _key_only;
+    std::optional<commitlog_compressed_mutation> _compressed;
+public:
+    // Mutations smaller than this are never compressed.
+    static constexpr size_t min_compressed_mutation_size = 1024;
+    static constexpr size_t compressed_chunk_size = 64 * 1024;
 private:
     template<typename Output>
     void serialize(Output&) const;
     void compute_size();
+    void compress(const compressor& c);
 public:
-    commitlog_entry_writer(schema_ptr s, const frozen_mutation& fm, force_sync sync)
+    // If compressor is given, the mutation is written compressed with it,
+    // provided that it is large enough and compresses well. Entries only
+    // record the compressor name, so compressors which need their options
+    // to uncompress (e.g. zstd with a dictionary) are not used.
+    commitlog_entry_writer(schema_ptr s, const frozen_mutation& fm, force_sync sync, compressor_ptr compressor = nullptr)
         : _schema(std::move(s)), _mutation(fm), _sync(sync)
-    {}
+    {
+        if (compressor && !compressor->uncompress_depends_on_options() && fm.representation().size() >= min_compressed_mutation_size) {
+            compress(*compressor);
+        }
+    }
 
     void set_with_schema(bool value) {
         _with_schema = value;
@@ -118,6 +151,9 @@ class commitlog_entry_writer {
     size_t mutation_size() const {
         return _mutation.representation().size();
     }
+    bool compressed() const {
+        return bool(_compressed);
+    }
     force_sync sync() const {
         return _sync;
     }
@@ -127,6 +163,8 @@ class commitlog_entry_writer {
     void write(ostream& out) const;
 };
 
+// Decompresses mutations stored compressed, so that users always see
+// the plain frozen mutation.
 class commitlog_entry_reader {
     commitlog_entry _ce;
 public:
@@ -15,6 +15,7 @@
 
 #include <seastar/core/future.hh>
 #include <seastar/core/sharded.hh>
+#include <seastar/core/semaphore.hh>
 
 #include "commitlog.hh"
 #include "commitlog_replayer.hh"
@@ -77,7 +78,12 @@ class db::commitlog_replayer::impl {
         return _column_mappings.stop();
     }
 
-    future<> process(stats*, commitlog::buffer_and_replay_position buf_rp) const;
+    // Limit on the total size of entries being applied concurrently,
+    // while reading of the segment goes on.
+    static constexpr size_t max_inflight_bytes = 32 << 20;
+
+    future<> process(stats*, semaphore& inflight, commitlog::buffer_and_replay_position buf_rp) const;
+    future<> apply(stats*, commitlog_entry_reader cer, const column_mapping& src_cm, replay_position rp, dht::shard_replica_set shards) const;
     future<stats> recover(sstring file, const sstring& fname_prefix) const;
 
     typedef std::unordered_map<table_id, replay_position> rp_map;
@@ -179,28 +185,40 @@ db::commitlog_replayer::impl::recover(sstring file, const sstring& fname_prefix)
     }
 
     auto s = make_lw_shared<stats>();
+    auto inflight = make_lw_shared<semaphore>(max_inflight_bytes);
     auto& exts = _db.local().extensions();
 
     return db::commitlog::read_log_file(file, fname_prefix,
-            std::bind(&impl::process, this, s.get(), std::placeholders::_1),
-            p, &exts).then_wrapped([s](future<> f) {
-        try {
-            f.get();
-        } catch (commitlog::segment_data_corruption_error& e) {
-            s->corrupt_bytes += e.bytes();
-        } catch (commitlog::segment_truncation& e) {
-            s->truncated_at = e.position();
-        } catch (...) {
-            throw;
-        }
-        return make_ready_future<stats>(*s);
+            [this, s, inflight] (commitlog::buffer_and_replay_position buf_rp) {
+                return process(s.get(), *inflight, std::move(buf_rp));
+            },
+            p, &exts).then_wrapped([s, inflight](future<> f) {
+        // wait for the entries still being applied
+        return inflight->wait(max_inflight_bytes).then([s, f = std::move(f)] () mutable {
+            try {
+                f.get();
+            } catch (commitlog::segment_data_corruption_error& e) {
+                s->corrupt_bytes += e.bytes();
+            } catch (commitlog::segment_truncation& e) {
+                s->truncated_at = e.position();
+            } catch (...) {
+                throw;
+            }
+            return make_ready_future<stats>(*s);
+        });
     });
 }
 
-future<> db::commitlog_replayer::impl::process(stats* s, commitlog::buffer_and_replay_position buf_rp) const {
+future<> db::commitlog_replayer::impl::process(stats* s, semaphore& inflight, commitlog::buffer_and_replay_position buf_rp) const {
     auto&& buf = buf_rp.buffer;
     auto&& rp = buf_rp.position;
     try {
+        // Check this before paying for deserialization.
+        if (rp < min_pos(rp.shard_id())) {
+            rlogger.trace("entry {} is less than global min position. skipping", rp);
+            s->skipped_mutations++;
+            co_return;
+        }
 
         commitlog_entry_reader cer(buf);
         auto& fm = cer.mutation();
@@ -218,11 +236,6 @@ future<> db::commitlog_replayer::impl::process(stats* s, commitlog::buffer_and_r
         const column_mapping& src_cm = cm_it->second;
 
         auto shard_id = rp.shard_id();
-        if (rp < min_pos(shard_id)) {
-            rlogger.trace("entry {} is less than global min position. skipping", rp);
-            s->skipped_mutations++;
-            co_return;
-        }
 
         auto uuid = fm.column_family_id();
         auto& table = _db.local().find_column_family(uuid);
@@ -244,7 +257,29 @@ future<> db::commitlog_replayer::impl::process(stats* s, commitlog::buffer_and_r
             co_return;
         }
 
-      auto apply = [&] (seastar::shard_id shard) {
+        auto shards = table.get_effective_replication_map()->shard_for_writes(schema, token);
+        if (shards.empty()) {
+            rlogger.debug("no shard for token {} in table {}", token, uuid);
+            s->skipped_mutations++;
+        } else {
+            // Let the application run in the background, so that reading and
+            // deserializing of the following entries overlaps with it. Order of
+            // application does not matter, mutations commute.
+            auto units = co_await get_units(inflight, std::min(buf.size_bytes(), max_inflight_bytes));
+            (void)apply(s, std::move(cer), src_cm, rp, std::move(shards)).finally([units = std::move(units)] {});
+        }
+    } catch (replica::no_such_column_family&) {
+        // No such CF now? Origin just ignores this.
+    } catch (...) {
+        s->invalid_mutations++;
+        // TODO: write mutation to file like origin.
+        rlogger.warn("error replaying: {}", std::current_exception());
+    }
+}
+
+future<> db::commitlog_replayer::impl::apply(stats* s, commitlog_entry_reader cer, const column_mapping& src_cm, replay_position rp, dht::shard_replica_set shards) const {
+    auto& fm = cer.mutation();
+    co_await seastar::parallel_for_each(shards, [&] (seastar::shard_id shard) {
         return _db.invoke_on(shard, [this, &fm, &src_cm, rp] (replica::database& db) mutable -> future<> {
             // TODO: might need better verification that the deserialized mutation
             // is schema compatible. My guess is that just applying the mutation
@@ -287,21 +322,7 @@ future<> db::commitlog_replayer::impl::process(stats* s, commitlog::buffer_and_r
                 rlogger.warn("error replaying: {}", std::current_exception());
             }
         });
-      };
-        auto shards = table.get_effective_replication_map()->shard_for_writes(schema, token);
-        if (shards.empty()) {
-            rlogger.debug("no shard for token {} in table {}", token, uuid);
-            s->skipped_mutations++;
-        } else {
-            co_await seastar::parallel_for_each(shards, apply);
-        }
-    } catch (replica::no_such_column_family&) {
-        // No such CF now? Origin just ignores this.
-    } catch (...) {
-        s->invalid_mutations++;
-        // TODO: write mutation to file like origin.
-        rlogger.warn("error replaying: {}", std::current_exception());
-    }
+    });
 }
 
 db::commitlog_replayer::commitlog_replayer(seastar::sharded<replica::database>& db, seastar::sharded<db::system_keyspace>& sys_ks)
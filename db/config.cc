@@ -557,6 +557,9 @@ db::config::config(std::shared_ptr<db::extensions> exts)
         "Whether or not to use O_DSYNC mode for commitlog segments IO. Can improve commitlog latency on some file systems.\n")
     , commitlog_use_hard_size_limit(this, "commitlog_use_hard_size_limit", value_status::Used, true,
         "Whether or not to use a hard size limit for commitlog disk usage. Default is true. Enabling this can cause latency spikes, whereas the default can lead to occasional disk usage peaks.\n")
+    , commitlog_use_table_compression(this, "commitlog_use_table_compression", value_status::Used, false,
+        "Whether or not to compress large mutations written to the commitlog, using the sstable compressor of their table. Tables without compression, or using a zstd dictionary, are not affected. Reduces commitlog bandwidth for compressible data at the cost of CPU. "
+        "Commitlog segments written with this enabled use a new segment format, which older versions refuse to replay: drain the node before downgrading.\n")
     /**
     * @Group Compaction settings
     * @GroupDescription Related information: Configuring compaction
@@ -807,6 +810,10 @@ db::config::config(std::shared_ptr<db::extensions> exts)
         "Enable or disable keepalive on client connections (CQL native, Redis and the maintenance socket).")
     , cache_hit_rate_read_balancing(this, "cache_hit_rate_read_balancing", value_status::Used, true,
         "This boolean controls whether the replicas for read query will be chosen based on cache hit ratio.")
+    , range_read_speculative_retry(this, "range_read_speculative_retry", liveness::LiveUpdate, value_status::Used, false,
+        "Whether range scans honour the speculative_retry option of the table. When enabled, each sub-range read sends an additional request to another replica if its replicas do not answer in time, just like single partition reads do. A percentile is taken from the latencies of sub-range reads rather than those of single partition reads.")
+    , enable_unprepared_statements_cache(this, "enable_unprepared_statements_cache", value_status::Used, false,
+        "Whether to cache the parsed form of statements received in QUERY messages (i.e. not prepared), keyed by their exact text and the current keyspace. Saves parsing when clients repeat identical queries without preparing them. Queries differing only in literal values are considered different.")
     /**
     * @Group Advanced fault detection settings
     * @GroupDescription Settings to handle poorly performing or failing nodes.
@@ -963,6 +970,8 @@ db::config::config(std::shared_ptr<db::extensions> exts)
     , force_gossip_generation(this, "force_gossip_generation", liveness::LiveUpdate, value_status::Used, -1 , "Force gossip to use the generation number provided by user.")
     , experimental_features(this, "experimental_features", value_status::Used, {}, experimental_features_help_string())
     , lsa_reclamation_step(this, "lsa_reclamation_step", value_status::Used, 1, "Minimum number of segments to reclaim in a single step.")
+    , lsa_background_reclaim_free_memory_fraction(this, "lsa_background_reclaim_free_memory_fraction", value_status::Used, 0.0,
+        "The fraction of shard memory which the background reclaimer keeps free, so that allocations rarely have to evict or compact memory themselves. Large shards benefit from a bigger reserve, since freeing memory inline causes latency spikes. Must be between 0.0 and 0.5. The default value 0.0 means a fixed reserve of 60MB.")
     , prometheus_port(this, "prometheus_port", value_status::Used, 9180, "Prometheus port, set to zero to disable.")
     , prometheus_address(this, "prometheus_address", value_status::Used, {/* listen_address */}, "Prometheus listening address, defaulting to listen_address if not explicitly set.")
     , prometheus_prefix(this, "prometheus_prefix", value_status::Used, "scylla", "Set the prefix of the exported Prometheus metrics. Changing this will break Scylla's dashboard compatibility, do not change unless you know what you are doing.")
@@ -1049,10 +1058,18 @@ db::config::config(std::shared_ptr<db::extensions> exts)
         "To preserve backwards compatibility on old clusters, Scylla's default setting is `warn`. "
         "New clusters have this option set to `true` by scylla.yaml (which overrides the default `warn`), "
         "to make sure that trying to create an invalid view causes an error.")
+    , view_update_skip_read_for_new_partitions(this, "view_update_skip_read_for_new_partitions", liveness::LiveUpdate, value_status::Used, false,
+        "When generating view updates for a base write, don't read the existing base partition if no memtable "
+        "contains it and the bloom filters of all sstables rule it out. Saves a read per write for tables which "
+        "are mostly written to with new partition keys.")
     , reversed_reads_auto_bypass_cache(this, "reversed_reads_auto_bypass_cache", liveness::LiveUpdate, value_status::Used, false,
             "Bypass in-memory data cache (the row cache) when performing reversed queries.")
     , enable_optimized_reversed_reads(this, "enable_optimized_reversed_reads", liveness::LiveUpdate, value_status::Used, true,
             "Use a new optimized algorithm for performing reversed reads.")
+    , memtable_flush_parallelism(this, "memtable_flush_parallelism", liveness::LiveUpdate, value_status::Used, 1,
+            "The maximum number of sstables a single memtable is flushed to in parallel, each covering a part of the token range. Rounded down to a power of two. "
+            "Memtables are only split so that every part is at least 32MB, so small memtables are still flushed into a single sstable. "
+            "Splitting allows a flush to use more disk bandwidth than a single sstable writer can, at the cost of more sstables to compact.")
     , enable_cql_config_updates(this, "enable_cql_config_updates", liveness::LiveUpdate, value_status::Used, true,
             "Make the system.config table UPDATEable.")
     , enable_parallelized_aggregation(this, "enable_parallelized_aggregation", liveness::LiveUpdate, value_status::Used, true,
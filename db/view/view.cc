@@ -2578,10 +2578,16 @@ void view_builder::execute(build_step& step, exponential_backoff_retry r) {
         bookkeeping_ops.push_back(maybe_mark_view_as_built(view, first_token));
     }
     built.release();
-    for (auto& [view, _, next_token] : step.build_status) {
-        if (next_token) {
-            bookkeeping_ops.push_back(
-                    _sys_ks.update_view_build_progress(view->ks_name(), view->cf_name(), *next_token));
+    // Each step only covers batch_size rows, so persisting the progress after
+    // each of them would add a system table write per few rows built.
+    auto now_lowres = lowres_clock::now();
+    if (now_lowres - step.last_progress_update >= progress_update_interval) {
+        step.last_progress_update = now_lowres;
+        for (auto& [view, _, next_token] : step.build_status) {
+            if (next_token) {
+                bookkeeping_ops.push_back(
+                        _sys_ks.update_view_build_progress(view->ks_name(), view->cf_name(), *next_token));
+            }
         }
     }
     seastar::when_all_succeed(bookkeeping_ops.begin(), bookkeeping_ops.end()).handle_exception([] (std::exception_ptr ep) {
@@ -139,6 +139,8 @@ class view_builder final : public service::migration_listener::only_view_notific
         mutation_reader reader{nullptr};
         dht::decorated_key current_key{dht::minimum_token(), partition_key::make_empty()};
         std::vector<view_build_status> build_status;
+        // When the progress of the views was last persisted.
+        lowres_clock::time_point last_progress_update;
 
         const dht::token& current_token() const {
             return current_key.token();
@@ -186,6 +188,9 @@ class view_builder final : public service::migration_listener::only_view_notific
     // collected batch_memory_max bytes, we can process the rows read so far.
     static constexpr size_t batch_size = 128;
     static constexpr size_t batch_memory_max = 1024*1024;
+    // The build progress is persisted at most this often. A restarted build
+    // redoes at most this much work, which is harmless as it's idempotent.
+    static constexpr auto progress_update_interval = std::chrono::seconds(1);
 
     replica::database& get_db() noexcept { return _db; }
 
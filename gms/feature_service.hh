@@ -126,6 +126,11 @@ class feature_service final : public peering_sharded_service<feature_service> {
     gms::feature group0_schema_versioning { *this, "GROUP0_SCHEMA_VERSIONING"sv };
     gms::feature supports_consistent_topology_changes { *this, "SUPPORTS_CONSISTENT_TOPOLOGY_CHANGES"sv };
     gms::feature host_id_based_hinted_handoff { *this, "HOST_ID_BASED_HINTED_HANDOFF"sv };
+    gms::feature approx_count_distinct_aggregate { *this, "APPROX_COUNT_DISTINCT_AGGREGATE"sv };
+    // The 'admission' caching option, which older nodes can't parse.
+    gms::feature cache_admission_option { *this, "CACHE_ADMISSION_OPTION"sv };
+    // The 'priority' caching option, which older nodes can't parse.
+    gms::feature cache_priority_option { *this, "CACHE_PRIORITY_OPTION"sv };
 
     // A feature just for use in tests. It must not be advertised unless
     // the "features_enable_test_feature" injection is enabled.
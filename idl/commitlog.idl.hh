@@ -9,7 +9,15 @@
 #include "idl/mutation.idl.hh"
 #include "idl/frozen_mutation.idl.hh"
 
+struct commitlog_compressed_mutation {
+    sstring compressor;
+    uint32_t size;
+    uint32_t chunk_size;
+    std::vector<bytes> chunks;
+};
+
 class commitlog_entry [[writable]] {
     std::optional<column_mapping> mapping();
     frozen_mutation mutation();
+    std::optional<commitlog_compressed_mutation> compressed_mutation() [[version 6.1]];
 };
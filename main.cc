@@ -830,12 +830,18 @@ To start the scylla server proper, simply invoke as: scylla server (or just scyl
             auto background_reclaim_scheduling_group = make_sched_group("background_reclaim", "bgre", 50);
             auto maintenance_scheduling_group = make_sched_group("streaming", "strm", 200);
 
+            if (auto f = cfg->lsa_background_reclaim_free_memory_fraction(); !(f >= 0.0 && f <= 0.5)) {
+                startlog.error("Bad configuration: lsa_background_reclaim_free_memory_fraction must be between 0.0 and 0.5, got {}", f);
+                throw bad_configuration_error();
+            }
+
             smp::invoke_on_all([&cfg, background_reclaim_scheduling_group] {
                 logalloc::tracker::config st_cfg;
                 st_cfg.defragment_on_idle = cfg->defragment_memory_on_idle();
                 st_cfg.abort_on_lsa_bad_alloc = cfg->abort_on_lsa_bad_alloc();
                 st_cfg.lsa_reclamation_step = cfg->lsa_reclamation_step();
                 st_cfg.background_reclaim_sched_group = background_reclaim_scheduling_group;
+                st_cfg.background_reclaim_free_memory_threshold = cfg->lsa_background_reclaim_free_memory_fraction() * memory::stats().total_memory();
                 st_cfg.sanitizer_report_backtrace = cfg->sanitizer_report_backtrace();
                 logalloc::shard_tracker().configure(st_cfg);
             }).get();
@@ -1188,6 +1194,9 @@ To start the scylla server proper, simply invoke as: scylla server (or just scyl
 
             supervisor::notify("starting query processor");
             cql3::query_processor::memory_config qp_mcfg = {memory::stats().total_memory() / 256, memory::stats().total_memory() / 2560};
+            if (cfg->enable_unprepared_statements_cache()) {
+                qp_mcfg.unprepared_statement_cache_size = memory::stats().total_memory() / 2560;
+            }
             debug::the_query_processor = &qp;
             auto local_data_dict = seastar::sharded_parameter([] (const replica::database& db) { return db.as_data_dictionary(); }, std::ref(db));
 
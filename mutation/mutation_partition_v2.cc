@@ -265,9 +265,16 @@ stop_iteration mutation_partition_v2::apply_monotonically(const schema& s, const
         if (i != _rows.end()) {
             auto x = cmp(*i, src_e);
             if (x < 0) {
-                bool match;
-                i = _rows.lower_bound(src_e, match, cmp);
-                miss = !match;
+                // Rows of append-only tables, e.g. time series, usually come
+                // after all rows of the partition, so check that before
+                // looking the row up.
+                if (cmp(*std::prev(_rows.end()), src_e) < 0) {
+                    i = _rows.end();
+                } else {
+                    bool match;
+                    i = _rows.lower_bound(src_e, match, cmp);
+                    miss = !match;
+                }
             } else {
                 miss = x > 0;
             }
@@ -682,7 +682,7 @@ partition_snapshot_ptr partition_entry::read(logalloc::region& r,
     return partition_snapshot_ptr(std::move(snp));
 }
 
-void partition_snapshot::touch() noexcept {
+void partition_snapshot::touch(bool refresh) noexcept {
     // Eviction assumes that older versions are evicted before newer so only the latest snapshot
     // can be touched.
     if (_tracker && at_latest_version()) {
@@ -690,7 +690,7 @@ void partition_snapshot::touch() noexcept {
         assert(!rows.empty());
         rows_entry& last_dummy = *rows.rbegin();
         assert(last_dummy.is_last_dummy());
-        _tracker->touch(last_dummy);
+        _tracker->touch(last_dummy, refresh);
     }
 }
 
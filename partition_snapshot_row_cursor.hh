@@ -621,7 +621,7 @@ class partition_snapshot_row_cursor final {
             auto latest_i = get_iterator_in_latest_version();
             rows_entry& latest = *latest_i;
             if (_snp.at_latest_version()) {
-                _snp.tracker()->touch(latest);
+                _snp.tracker()->touch(latest, !_schema.caching_options().low_priority());
             }
             return {latest, latest_i, false};
         } else {
@@ -737,7 +737,7 @@ class partition_snapshot_row_cursor final {
         // could result violate ordering invariant for the LRU, which states that older versions
         // must be evicted first. Needed to keep the snapshot consistent.
         if (_snp.at_latest_version() && is_in_latest_version()) {
-            _snp.tracker()->touch(*get_iterator_in_latest_version());
+            _snp.tracker()->touch(*get_iterator_in_latest_version(), !_schema.caching_options().low_priority());
         }
     }
 
@@ -1253,7 +1253,9 @@ keyspace::make_column_family_config(const schema& s, const database& db) const {
     cfg.enable_metrics_reporting = db_config.enable_keyspace_column_family_metrics();
     cfg.enable_node_aggregated_table_metrics = db_config.enable_node_aggregated_table_metrics();
     cfg.reversed_reads_auto_bypass_cache = db_config.reversed_reads_auto_bypass_cache;
+    cfg.view_update_skip_read_for_new_partitions = db_config.view_update_skip_read_for_new_partitions;
     cfg.enable_optimized_reversed_reads = db_config.enable_optimized_reversed_reads;
+    cfg.memtable_flush_parallelism = db_config.memtable_flush_parallelism;
     cfg.tombstone_warn_threshold = db_config.tombstone_warn_threshold();
     cfg.view_update_concurrency_semaphore_limit = _config.view_update_concurrency_semaphore_limit;
     cfg.data_listeners = &db.data_listeners();
@@ -1903,7 +1905,7 @@ future<> database::apply_with_commitlog(column_family& cf, const mutation& m, db
         auto fm = freeze(m);
         std::exception_ptr ex;
         try {
-            commitlog_entry_writer cew(m.schema(), fm, db::commitlog::force_sync::no);
+            commitlog_entry_writer cew(m.schema(), fm, db::commitlog::force_sync::no, commitlog_compressor(*m.schema(), cf.commitlog()));
             auto f_h = co_await coroutine::as_future(cf.commitlog()->add_entry(m.schema()->id(), cew, timeout));
             if (!f_h.failed()) {
                 h = f_h.get();
@@ -1938,6 +1940,13 @@ future<> database::apply(const std::vector<frozen_mutation>& muts, db::timeout_c
     return update_write_metrics(do_apply_many(muts, timeout));
 }
 
+compressor_ptr database::commitlog_compressor(const schema& s, const db::commitlog* cl) const {
+    if (!cl || !cl->active_config().allow_compressed_entries) {
+        return nullptr;
+    }
+    return s.get_compressor_params().get_compressor();
+}
+
 future<> database::do_apply_many(const std::vector<frozen_mutation>& muts, db::timeout_clock::time_point timeout) {
     std::vector<commitlog_entry_writer> writers;
     db::commitlog* cl = nullptr;
@@ -1967,7 +1976,7 @@ future<> database::do_apply_many(const std::vector<frozen_mutation>& muts, db::t
         }
 
         dblog.trace("apply [{}/{}]: {}", i, muts.size() - 1, muts[i].pretty_printer(s));
-        writers.emplace_back(s, muts[i], commitlog_entry_writer::force_sync::yes);
+        writers.emplace_back(s, muts[i], commitlog_entry_writer::force_sync::yes, commitlog_compressor(*s, cf.commitlog()));
     }
 
     if (!cl) {
@@ -2034,7 +2043,7 @@ future<> database::do_apply(schema_ptr s, const frozen_mutation& m, tracing::tra
     if (cl != nullptr && cf.durable_writes()) {
         std::exception_ptr ex;
         try {
-            commitlog_entry_writer cew(s, m, sync);
+            commitlog_entry_writer cew(s, m, sync, commitlog_compressor(*s, cl));
             auto f_h = co_await coroutine::as_future(cf.commitlog()->add_entry(uuid, cew, timeout));
             if (!f_h.failed()) {
                 h = f_h.get();
@@ -359,6 +359,7 @@ struct table_stats {
     utils::timed_rate_moving_average_and_histogram tombstone_scanned;
     utils::timed_rate_moving_average_and_histogram live_scanned;
     utils::estimated_histogram estimated_coordinator_read;
+    utils::estimated_histogram estimated_coordinator_range_read;
 };
 
 using storage_options = data_dictionary::storage_options;
@@ -418,7 +419,9 @@ class table : public enable_lw_shared_from_this<table>
         // Not really table-specific (it's a global configuration parameter), but stored here
         // for easy access from `table` member functions:
         utils::updateable_value<bool> reversed_reads_auto_bypass_cache{false};
+        utils::updateable_value<bool> view_update_skip_read_for_new_partitions{false};
         utils::updateable_value<bool> enable_optimized_reversed_reads{true};
+        utils::updateable_value<uint32_t> memtable_flush_parallelism{1};
         uint32_t tombstone_warn_threshold{0};
         unsigned x_log2_compaction_groups{0};
         utils::updateable_value<bool> enable_compacting_data_for_streaming_and_repair;
@@ -517,6 +520,10 @@ class table : public enable_lw_shared_from_this<table>
     lowres_clock::time_point _percentile_cache_timestamp;
     std::chrono::milliseconds _percentile_cache_value;
 
+    double _cached_range_read_percentile = -1;
+    lowres_clock::time_point _range_read_percentile_cache_timestamp;
+    std::chrono::milliseconds _range_read_percentile_cache_value;
+
     // Phaser used to synchronize with in-progress writes. This is useful for code that,
     // after some modification, needs to ensure that news writes will see it before
     // it can proceed, such as the view building code.
@@ -1135,6 +1142,9 @@ class table : public enable_lw_shared_from_this<table>
 
     void add_coordinator_read_latency(utils::estimated_histogram::duration latency);
     std::chrono::milliseconds get_coordinator_read_latency_percentile(double percentile);
+    // Same as above, for the sub-range reads of range scans.
+    void add_coordinator_range_read_latency(utils::estimated_histogram::duration latency);
+    std::chrono::milliseconds get_coordinator_range_read_latency_percentile(double percentile);
 
     secondary_index::secondary_index_manager& get_index_manager() {
         return _index_manager;
@@ -1166,6 +1176,9 @@ class table : public enable_lw_shared_from_this<table>
     future<row_locker::lock_holder> do_push_view_replica_updates(shared_ptr<db::view::view_update_generator> gen, schema_ptr s, mutation m, db::timeout_clock::time_point timeout, mutation_source source,
             tracing::trace_state_ptr tr_state, reader_concurrency_semaphore& sem, query::partition_slice::option_set custom_opts) const;
     std::vector<view_ptr> affected_views(shared_ptr<db::view::view_update_generator> gen, const schema_ptr& base, const mutation& update) const;
+    // False if neither the memtables nor the sstables (going by their
+    // bloom filters) can contain the partition.
+    bool may_contain_partition(const dht::decorated_key& dk) const;
 
     mutable row_locker _row_locker;
     future<row_locker::lock_holder> local_base_lock(
@@ -1556,6 +1569,8 @@ class database : public peering_sharded_service<database> {
     void setup_scylla_memory_diagnostics_producer();
 
     future<> do_apply(schema_ptr, const frozen_mutation&, tracing::trace_state_ptr tr_state, db::timeout_clock::time_point timeout, db::commitlog_force_sync sync, db::per_partition_rate_limit::info rate_limit_info);
+    // The compressor to write mutations of the given table to the given commitlog with, if any.
+    compressor_ptr commitlog_compressor(const schema& s, const db::commitlog* cl) const;
     future<> do_apply_many(const std::vector<frozen_mutation>&, db::timeout_clock::time_point timeout);
     future<> apply_with_commitlog(column_family& cf, const mutation& m, db::timeout_clock::time_point timeout);
 
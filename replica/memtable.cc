@@ -15,6 +15,8 @@
 #include "readers/empty_v2.hh"
 #include "readers/forwardable_v2.hh"
 #include "sstables/types.hh"
+#include "dht/i_partitioner.hh"
+#include <bit>
 
 namespace replica {
 
@@ -250,6 +252,22 @@ memtable::contains_partition(const dht::decorated_key& key) const {
     return partitions.find(key, dht::ring_position_comparator(*_schema)) != partitions.end();
 }
 
+dht::partition_range_vector
+memtable::flush_ranges(uint32_t parallelism, size_t min_split_size) const {
+    auto splits = std::min<uint64_t>(parallelism, occupancy().used_space() / std::max<size_t>(min_split_size, 1));
+    if (splits <= 1) {
+        return {query::full_partition_range};
+    }
+    auto ranges = dht::to_partition_ranges(dht::split_token_range_msb(std::bit_width(splits) - 1));
+    std::erase_if(ranges, [this] (const dht::partition_range& r) {
+        return slice(r).empty();
+    });
+    if (ranges.empty()) {
+        return {query::full_partition_range};
+    }
+    return ranges;
+}
+
 boost::iterator_range<memtable::partitions_type::const_iterator>
 memtable::slice(const dht::partition_range& range) const {
     if (query::is_single_partition(range)) {
@@ -627,9 +645,9 @@ class flush_reader final : public mutation_reader::impl, private iterator_reader
     mutation_reader_opt _partition_reader;
     flush_memory_accounter _flushed_memory;
 public:
-    flush_reader(schema_ptr s, reader_permit permit, lw_shared_ptr<memtable> m)
+    flush_reader(schema_ptr s, reader_permit permit, lw_shared_ptr<memtable> m, const dht::partition_range& range)
         : impl(s, std::move(permit))
-        , iterator_reader(std::move(s), m, query::full_partition_range)
+        , iterator_reader(std::move(s), m, range)
         , _flushed_memory(*m)
     {}
     flush_reader(const flush_reader&) = delete;
@@ -750,13 +768,13 @@ memtable::make_flat_reader_opt(schema_ptr s,
 }
 
 mutation_reader
-memtable::make_flush_reader(schema_ptr s, reader_permit permit) {
+memtable::make_flush_reader(schema_ptr s, reader_permit permit, const dht::partition_range& range) {
     if (!_merged_into_cache) {
-        return make_mutation_reader<flush_reader>(std::move(s), std::move(permit), shared_from_this());
+        return make_mutation_reader<flush_reader>(std::move(s), std::move(permit), shared_from_this(), range);
     } else {
         auto& full_slice = s->full_slice();
         return make_mutation_reader<scanning_reader>(std::move(s), shared_from_this(), std::move(permit),
-                      query::full_partition_range, full_slice, mutation_reader::forwarding::no);
+                      range, full_slice, mutation_reader::forwarding::no);
     }
 }
 
@@ -267,7 +267,16 @@ class memtable final : public enable_lw_shared_from_this<memtable>, private dirt
         return make_flat_reader(s, std::move(permit), range, full_slice);
     }
 
-    mutation_reader make_flush_reader(schema_ptr, reader_permit permit);
+    // Returns the token ranges this memtable is split into when flushed to
+    // several sstables in parallel. At most `parallelism` ranges, rounded
+    // down to a power of two, are returned, and only as many as leave
+    // `min_split_size` of memory to every range on average. Ranges holding
+    // no partitions are left out, so every returned range has data unless
+    // the memtable is empty.
+    dht::partition_range_vector flush_ranges(uint32_t parallelism, size_t min_split_size) const;
+
+    // The range must be alive as long as the reader.
+    mutation_reader make_flush_reader(schema_ptr, reader_permit permit, const dht::partition_range& range = query::full_partition_range);
 
     mutation_source as_data_source();
 
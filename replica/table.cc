@@ -1325,6 +1325,11 @@ table::seal_active_memtable(compaction_group& cg, flush_permit&& flush_permit) n
     // FIXME: provide back-pressure to upper layers
 }
 
+// Every sstable a memtable is split into when flushed in parallel is
+// expected to hold at least this much of the memtable.
+static constexpr size_t min_flush_split_size = 32 << 20;
+static constexpr uint32_t max_flush_parallelism = 64;
+
 future<>
 table::try_flush_memtable_to_sstable(compaction_group& cg, lw_shared_ptr<memtable> old, sstable_write_permit&& permit) {
     auto try_flush = [this, old = std::move(old), permit = make_lw_shared(std::move(permit)), &cg] () mutable -> future<> {
@@ -1344,13 +1349,15 @@ table::try_flush_memtable_to_sstable(compaction_group& cg, lw_shared_ptr<memtabl
         auto metadata = mutation_source_metadata{};
         metadata.min_timestamp = old->get_min_timestamp();
         metadata.max_timestamp = old->get_max_timestamp();
+        auto flush_ranges = old->flush_ranges(std::min(_config.memtable_flush_parallelism(), max_flush_parallelism), min_flush_split_size);
         auto estimated_partitions = _compaction_strategy.adjust_partition_estimate(metadata, old->partition_count(), _schema);
+        estimated_partitions = std::max<uint64_t>(estimated_partitions / flush_ranges.size(), 1);
 
         if (!cg.async_gate().is_closed()) {
             co_await _compaction_manager.maybe_wait_for_sstable_count_reduction(cg.as_table_state());
         }
 
-        auto consumer = _compaction_strategy.make_interposer_consumer(metadata, [this, old, permit, &newtabs, estimated_partitions, &cg] (mutation_reader reader) mutable -> future<> {
+        auto write_sstable = [this, old, permit, &newtabs, estimated_partitions, &cg] (mutation_reader reader) mutable -> future<> {
           std::exception_ptr ex;
           try {
             sstables::sstable_writer_config cfg = get_sstables_manager().configure_writer("memtable");
@@ -1369,11 +1376,24 @@ table::try_flush_memtable_to_sstable(compaction_group& cg, lw_shared_ptr<memtabl
           }
           co_await reader.close();
           co_await coroutine::return_exception_ptr(std::move(ex));
-        });
+        };
 
-        auto f = consumer(old->make_flush_reader(
-            old->schema(),
-            compaction_concurrency_semaphore().make_tracking_only_permit(old->schema(), "try_flush_memtable_to_sstable()", db::no_timeout, {})));
+        if (flush_ranges.size() > 1) {
+            tlogger.debug("Flushing memtable of {}.{} into {} token ranges in parallel", _schema->ks_name(), _schema->cf_name(), flush_ranges.size());
+        }
+        // Every range gets its own interposer consumer, as they are not
+        // required to support concurrent invocations.
+        std::vector<reader_consumer_v2> consumers;
+        consumers.reserve(flush_ranges.size());
+        for (size_t i = 0; i < flush_ranges.size(); ++i) {
+            consumers.push_back(_compaction_strategy.make_interposer_consumer(metadata, write_sstable));
+        }
+        auto f = parallel_for_each(boost::irange(size_t(0), flush_ranges.size()), [this, old, &consumers, &flush_ranges] (size_t i) {
+            return consumers[i](old->make_flush_reader(
+                old->schema(),
+                compaction_concurrency_semaphore().make_tracking_only_permit(old->schema(), "try_flush_memtable_to_sstable()", db::no_timeout, {}),
+                flush_ranges[i]));
+        });
 
         // Switch back to default scheduling group for post-flush actions, to avoid them being staved by the memtable flush
         // controller. Cache update does not affect the input of the memtable cpu controller, so it can be subject to
@@ -3167,14 +3187,29 @@ void table::add_coordinator_read_latency(utils::estimated_histogram::duration la
     _stats.estimated_coordinator_read.add(std::chrono::duration_cast<std::chrono::microseconds>(latency).count());
 }
 
-std::chrono::milliseconds table::get_coordinator_read_latency_percentile(double percentile) {
-    if (_cached_percentile != percentile || lowres_clock::now() - _percentile_cache_timestamp > 1s) {
-        _percentile_cache_timestamp = lowres_clock::now();
-        _cached_percentile = percentile;
-        _percentile_cache_value = std::max(_stats.estimated_coordinator_read.percentile(percentile) / 1000, int64_t(1)) * 1ms;
-        _stats.estimated_coordinator_read *= 0.9; // decay values a little to give new data points more weight
+static std::chrono::milliseconds get_latency_percentile(utils::estimated_histogram& histogram, double percentile,
+        double& cached_percentile, lowres_clock::time_point& cache_timestamp, std::chrono::milliseconds& cache_value) {
+    if (cached_percentile != percentile || lowres_clock::now() - cache_timestamp > 1s) {
+        cache_timestamp = lowres_clock::now();
+        cached_percentile = percentile;
+        cache_value = std::max(histogram.percentile(percentile) / 1000, int64_t(1)) * 1ms;
+        histogram *= 0.9; // decay values a little to give new data points more weight
     }
-    return _percentile_cache_value;
+    return cache_value;
+}
+
+std::chrono::milliseconds table::get_coordinator_read_latency_percentile(double percentile) {
+    return get_latency_percentile(_stats.estimated_coordinator_read, percentile,
+            _cached_percentile, _percentile_cache_timestamp, _percentile_cache_value);
+}
+
+void table::add_coordinator_range_read_latency(utils::estimated_histogram::duration latency) {
+    _stats.estimated_coordinator_range_read.add(std::chrono::duration_cast<std::chrono::microseconds>(latency).count());
+}
+
+std::chrono::milliseconds table::get_coordinator_range_read_latency_percentile(double percentile) {
+    return get_latency_percentile(_stats.estimated_coordinator_range_read, percentile,
+            _cached_range_read_percentile, _range_read_percentile_cache_timestamp, _range_read_percentile_cache_value);
 }
 
 void
@@ -3361,6 +3396,13 @@ future<row_locker::lock_holder> table::do_push_view_replica_updates(shared_ptr<d
     future<row_locker::lock_holder> lockf = local_base_lock(base, m.decorated_key(), slice.default_row_ranges(), timeout);
     co_await utils::get_local_injector().inject("table_push_view_replica_updates_timeout", timeout);
     auto lock = co_await std::move(lockf);
+    // Checked under the lock, so that a concurrent write of the same
+    // partition is either visible here or waits for us.
+    if (_config.view_update_skip_read_for_new_partitions() && !may_contain_partition(m.decorated_key())) {
+        tracing::trace(tr_state, "Base partition doesn't exist yet, skipping read-before-write");
+        co_await gen->generate_and_propagate_view_updates(*this, base, sem.make_tracking_only_permit(s, "push-view-updates-3", timeout, tr_state), std::move(views), std::move(m), { }, tr_state, now, timeout);
+        co_return std::move(lock);
+    }
     auto pk = dht::partition_range::make_singular(m.decorated_key());
     auto permit = sem.make_tracking_only_permit(base, "push-view-updates-2", timeout, tr_state);
     auto reader = source.make_reader_v2(base, permit, pk, slice, tr_state, streamed_mutation::forwarding::no, mutation_reader::forwarding::no);
@@ -3406,6 +3448,18 @@ table::as_mutation_source_excluding_staging() const {
     });
 }
 
+bool table::may_contain_partition(const dht::decorated_key& dk) const {
+    auto& sg = storage_group_for_token(dk.token());
+    for (auto& cg : sg.compaction_groups()) {
+        if (cg->memtable_has_key(dk)) {
+            return true;
+        }
+    }
+    return std::ranges::any_of(_sstables->select(dht::partition_range::make_singular(dk)), [&] (const sstables::shared_sstable& sst) {
+        return sst->filter_has_key(*_schema, dk);
+    });
+}
+
 std::vector<mutation_source> table::select_memtables_as_mutation_sources(dht::token token) const {
     auto& sg = storage_group_for_token(token);
     std::vector<mutation_source> mss;
@@ -14,6 +14,8 @@
 #include <seastar/core/metrics.hh>
 #include <seastar/core/thread.hh>
 #include <seastar/util/defer.hh>
+#include <seastar/coroutine/exception.hh>
+#include <seastar/coroutine/maybe_yield.hh>
 #include "replica/memtable.hh"
 #include <boost/version.hpp>
 #include <sys/sdt.h>
@@ -162,6 +164,7 @@ cache_tracker::setup_metrics() {
         sm::make_counter("partition_evictions", sm::description("total number of evicted partitions"), _stats.partition_evictions),
         sm::make_counter("partition_removals", sm::description("total number of invalidated partitions"), _stats.partition_removals),
         sm::make_counter("mispopulations", sm::description("number of entries not inserted by reads"), _stats.mispopulations),
+        sm::make_counter("partitions_not_admitted", sm::description("number of partitions missed by reads which were not inserted because they are not read frequently"), _stats.partitions_not_admitted),
         sm::make_gauge("partitions", sm::description("total number of cached partitions"), _stats.partitions),
         sm::make_gauge("rows", sm::description("total number of cached rows"), _stats.rows),
         sm::make_counter("reads", sm::description("number of started reads"), _stats.reads),
@@ -209,12 +212,15 @@ void cache_tracker::clear() {
     allocator().invalidate_references();
 }
 
-void cache_tracker::touch(rows_entry& e) {
+void cache_tracker::touch(rows_entry& e, bool refresh) {
     // last dummy may not be linked if evicted
     if (e.is_linked()) {
-        _lru.remove(e);
+        if (refresh) {
+            _lru.touch(e);
+        }
+    } else {
+        _lru.add(e);
     }
-    _lru.add(e);
 }
 
 void cache_tracker::insert(cache_entry& entry) {
@@ -269,6 +275,18 @@ void cache_tracker::on_mispopulate() noexcept {
     ++_stats.mispopulations;
 }
 
+bool cache_tracker::admit_partition(uint64_t key) noexcept {
+    _admission_sketch.increment(key);
+    // A partition seen for the first time in the current window is not
+    // admitted. This is enough to keep scans and one-off reads from
+    // displacing partitions which are read repeatedly.
+    if (_admission_sketch.frequency(key) < 2) {
+        ++_stats.partitions_not_admitted;
+        return false;
+    }
+    return true;
+}
+
 void cache_tracker::on_miss_already_populated() noexcept {
     ++_stats.concurrent_misses_same_key;
 }
@@ -413,6 +431,7 @@ class single_partition_populating_reader final : public mutation_reader::impl {
     row_cache& _cache;
     std::unique_ptr<read_context> _read_context;
     mutation_reader_opt _reader;
+    bool _populate;
 private:
     future<> create_reader() {
         auto src_and_phase = _cache.snapshot_of(_read_context->range().start()->value());
@@ -420,7 +439,13 @@ class single_partition_populating_reader final : public mutation_reader::impl {
         _read_context->enter_partition(_read_context->range().start()->value().as_decorated_key(), src_and_phase.snapshot, phase);
         return _read_context->create_underlying().then([this, phase] {
           return _read_context->underlying().underlying()().then([this, phase] (auto&& mfopt) {
-            if (!mfopt) {
+            if (!_populate) {
+                if (!mfopt) {
+                    _end_of_stream = true;
+                } else {
+                    _reader = read_directly_from_underlying(*_read_context, std::move(*mfopt));
+                }
+            } else if (!mfopt) {
                 if (phase == _cache.phase_of(_read_context->range().start()->value())) {
                     _cache._read_section(_cache._tracker.region(), [this] {
                         _cache.find_or_create_missing(_read_context->key());
@@ -443,10 +468,12 @@ class single_partition_populating_reader final : public mutation_reader::impl {
     }
 public:
     single_partition_populating_reader(row_cache& cache,
-            std::unique_ptr<read_context> context)
+            std::unique_ptr<read_context> context,
+            bool populate = true)
         : impl(context->schema(), context->permit())
         , _cache(cache)
         , _read_context(std::move(context))
+        , _populate(populate)
     { }
 
     virtual future<> fill_buffer() override {
@@ -509,6 +536,20 @@ void row_cache::on_mispopulate() {
     _tracker.on_mispopulate();
 }
 
+uint64_t row_cache::admission_key(const dht::decorated_key& key) const noexcept {
+    return uint64_t(key.token().raw()) ^ _schema->id().uuid().get_least_significant_bits();
+}
+
+void row_cache::on_partition_access(const dht::decorated_key& key) {
+    if (_schema->caching_options().admit_frequent_only()) {
+        _tracker.on_partition_access(admission_key(key));
+    }
+}
+
+bool row_cache::admit(const dht::decorated_key& key) {
+    return !_schema->caching_options().admit_frequent_only() || _tracker.admit_partition(admission_key(key));
+}
+
 void row_cache::on_row_miss() {
     _stats.misses.mark();
     _tracker.on_row_miss();
@@ -573,6 +614,11 @@ class range_populating_reader {
                 _cache.on_partition_miss();
                 const partition_start& ps = mfopt->as_partition_start();
                 const dht::decorated_key& key = ps.key();
+                if (!_cache.admit(key)) {
+                    // The partition is not inserted, so the range can't be marked as continuous across it.
+                    _last_key = {};
+                    return make_ready_future<mutation_reader_opt>(read_directly_from_underlying(_read_context, std::move(*mfopt)));
+                }
                 if (_reader.creation_phase() == _cache.phase_of(key)) {
                     return _cache._read_section(_cache._tracker.region(), [&] {
                         cache_entry& e = _cache.find_or_create_incomplete(ps, _reader.creation_phase(),
@@ -622,6 +668,7 @@ class scanning_and_populating_reader final : public mutation_reader::impl {
     mutation_reader read_from_entry(cache_entry& ce) {
         _cache.upgrade_entry(ce);
         _cache.on_partition_hit();
+        _cache.on_partition_access(ce.key());
         return ce.read(_cache, *_read_context);
     }
 
@@ -793,13 +840,14 @@ row_cache::make_reader_opt(schema_ptr s,
                 cache_entry& e = *i;
                 upgrade_entry(e);
                 on_partition_hit();
+                on_partition_access(e.key());
                 return e.read(*this, make_context());
             } else if (i->continuous()) {
                 return {};
             } else {
                 tracing::trace(trace_state, "Range {} not found in cache", range);
                 on_partition_miss();
-                return make_mutation_reader<single_partition_populating_reader>(*this, make_context());
+                return make_mutation_reader<single_partition_populating_reader>(*this, make_context(), admit(pos.as_decorated_key()));
             }
         });
 
@@ -1266,6 +1314,95 @@ future<> row_cache::invalidate(external_updater eu, dht::partition_range_vector&
     });
 }
 
+namespace {
+
+// Marks where a walk over the LRU stopped, so that it can continue after
+// preemption. It is evicted like the other elements, which unlinks it, and
+// then all less recently used elements are gone too.
+class lru_walk_position final : public evictable {
+public:
+    void on_evicted() noexcept override { }
+};
+
+}
+
+// Returns the cache entry whose latest version ends with e, if e is a last dummy.
+static cache_entry* cache_entry_of_last_dummy(rows_entry& e) noexcept {
+    if (!e.is_last_dummy()) {
+        return nullptr;
+    }
+    mutation_partition_v2::rows_type* rows = mutation_partition_v2::rows_type::iterator(&e).tree_if_last();
+    partition_version& pv = partition_version::container_of(mutation_partition_v2::container_of(*rows));
+    if (!pv.is_referenced_from_entry()) {
+        return nullptr;
+    }
+    return &cache_entry::container_of(partition_entry::container_of(pv));
+}
+
+future<std::vector<dht::decorated_key>> row_cache::hot_partition_keys(size_t max_keys) {
+    std::vector<dht::decorated_key> keys;
+    auto& lru = _tracker.get_lru();
+    lru_walk_position pos;
+    auto unlink_pos = defer([&] () noexcept {
+        if (pos.is_linked()) {
+            lru.remove(pos);
+        }
+    });
+
+    // Every read of a partition touches the last dummy of its latest
+    // version, so the order of the last dummies in the LRU is the order in
+    // which partitions were last read.
+    lru.add(pos);
+    while (keys.size() < max_keys && pos.is_linked()) {
+        auto step_keys = _read_section(_tracker.region(), [&] {
+            std::vector<dht::decorated_key> step_keys;
+            evictable* more_recent = &pos;
+            evictable* e = lru.less_recent(pos);
+            while (e && keys.size() + step_keys.size() < max_keys) {
+                if (auto* row = dynamic_cast<rows_entry*>(e)) {
+                    auto* ce = cache_entry_of_last_dummy(*row);
+                    if (ce && !ce->is_dummy_entry() && ce->schema()->id() == _schema->id()) {
+                        step_keys.push_back(ce->key());
+                    }
+                }
+                more_recent = e;
+                e = lru.less_recent(*e);
+                if (need_preempt()) {
+                    break;
+                }
+            }
+            lru.remove(pos);
+            if (e && more_recent != &pos) {
+                lru.add_before(*more_recent, pos);
+            }
+            return step_keys;
+        });
+        std::move(step_keys.begin(), step_keys.end(), std::back_inserter(keys));
+        co_await coroutine::maybe_yield();
+    }
+    co_return keys;
+}
+
+future<> row_cache::populate_from_underlying(std::vector<dht::decorated_key> keys, reader_permit permit) {
+    // One partition at a time, so that a single permit is enough and the
+    // warm-up never has more than one read in flight.
+    for (const auto& key : keys) {
+        auto range = dht::partition_range::make_singular(key);
+        auto rd = make_reader(_schema, permit, range);
+        std::exception_ptr ex;
+        try {
+            co_await rd.consume_pausable([] (mutation_fragment_v2) { return stop_iteration::no; });
+        } catch (...) {
+            ex = std::current_exception();
+        }
+        co_await rd.close();
+        if (ex) {
+            co_await coroutine::return_exception_ptr(std::move(ex));
+        }
+        co_await coroutine::maybe_yield();
+    }
+}
+
 void row_cache::evict() {
     while (_tracker.region().evict_some() == memory::reclaiming_result::reclaimed_something) {}
 }
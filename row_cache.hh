@@ -269,6 +269,10 @@ class row_cache final {
     void on_row_miss();
     void on_static_row_insert();
     void on_mispopulate();
+    uint64_t admission_key(const dht::decorated_key&) const noexcept;
+    void on_partition_access(const dht::decorated_key&);
+    // Tells whether a partition missed by a read should be inserted into the cache.
+    bool admit(const dht::decorated_key&);
     void upgrade_entry(cache_entry&);
     void invalidate_locked(const dht::decorated_key&);
     void clear_now() noexcept;
@@ -459,6 +463,22 @@ class row_cache final {
     future<> invalidate(external_updater, const dht::partition_range& = query::full_partition_range);
     future<> invalidate(external_updater, dht::partition_range_vector&&);
 
+    // Returns the keys of up to max_keys partitions present in cache, most
+    // recently read first.
+    //
+    // The keys are taken from the LRU, so they are the hot set of the table.
+    // The result can be passed to populate_from_underlying() to bring them
+    // back, e.g. after a restart. Yields while walking the LRU.
+    future<std::vector<dht::decorated_key>> hot_partition_keys(size_t max_keys);
+
+    // Reads the given partitions from the underlying mutation source into the
+    // cache, one after another, in the given order.
+    //
+    // This is background work competing with user reads, so it should be run
+    // in the maintenance scheduling group, with a permit of the maintenance
+    // reader concurrency semaphore, which pace its CPU use and I/O.
+    future<> populate_from_underlying(std::vector<dht::decorated_key> keys, reader_permit permit);
+
     // Evicts entries from cache.
     //
     // Note that this does not synchronize with the underlying source,
@@ -12,8 +12,8 @@
 #include "exceptions/exceptions.hh"
 #include "utils/rjson.hh"
 
-caching_options::caching_options(sstring k, sstring r, bool enabled)
-        : _key_cache(k), _row_cache(r), _enabled(enabled) {
+caching_options::caching_options(sstring k, sstring r, bool enabled, bool admit_frequent_only, bool low_priority)
+        : _key_cache(k), _row_cache(r), _enabled(enabled), _admit_frequent_only(admit_frequent_only), _low_priority(low_priority) {
     if ((k != "ALL") && (k != "NONE")) {
         throw exceptions::configuration_exception("Invalid key value: " + k); 
     }
@@ -40,6 +40,12 @@ caching_options::to_map() const {
     if (!_enabled) {
         res.insert({"enabled", "false"});
     }
+    if (_admit_frequent_only) {
+        res.insert({"admission", "FREQUENT"});
+    }
+    if (_low_priority) {
+        res.insert({"priority", "LOW"});
+    }
     return res;
 }
 
@@ -58,6 +64,8 @@ caching_options::from_map(const std::map<sstring, sstring>& map) {
     sstring k = default_key;
     sstring r = default_row;
     bool e = true;
+    bool f = false;
+    bool l = false;
 
     for (auto& p : map) {
         if (p.first == "keys") {
@@ -66,11 +74,21 @@ caching_options::from_map(const std::map<sstring, sstring>& map) {
             r = p.second;
         } else if (p.first == "enabled") {
             e = p.second == "true";
+        } else if (p.first == "admission") {
+            if (p.second != "ALL" && p.second != "FREQUENT") {
+                throw exceptions::configuration_exception("Invalid admission value: " + p.second);
+            }
+            f = p.second == "FREQUENT";
+        } else if (p.first == "priority") {
+            if (p.second != "NORMAL" && p.second != "LOW") {
+                throw exceptions::configuration_exception("Invalid priority value: " + p.second);
+            }
+            l = p.second == "LOW";
         } else {
             throw exceptions::configuration_exception(format("Invalid caching option: {}", p.first));
         }
     }
-    return caching_options(k, r, e);
+    return caching_options(k, r, e, f, l);
 }
 
 caching_options
@@ -25,7 +25,15 @@ class caching_options {
     sstring _key_cache;
     sstring _row_cache;
     bool _enabled = true;
-    caching_options(sstring k, sstring r, bool enabled);
+    // When set, a partition missed by a read is only inserted into the
+    // cache if it was read recently, so that one-off reads and scans don't
+    // push frequently read partitions out of the cache.
+    bool _admit_frequent_only = false;
+    // When set, reads don't move rows of the table to the most recently used
+    // end of the cache LRU. They are evicted in the order they were
+    // inserted, before rows of other tables which were read after that.
+    bool _low_priority = false;
+    caching_options(sstring k, sstring r, bool enabled, bool admit_frequent_only = false, bool low_priority = false);
 
     friend class schema;
     caching_options();
@@ -34,6 +42,14 @@ class caching_options {
         return _enabled;
     }
 
+    bool admit_frequent_only() const {
+        return _admit_frequent_only;
+    }
+
+    bool low_priority() const {
+        return _low_priority;
+    }
+
     std::map<sstring, sstring> to_map() const;
 
     sstring to_sstring() const;
@@ -5432,9 +5432,16 @@ class speculating_read_executor : public abstract_read_executor {
             }
         });
         auto& sr = _schema->speculative_retry();
-        auto t = (sr.get_type() == speculative_retry::type::PERCENTILE) ?
-            std::min(_cf->get_coordinator_read_latency_percentile(sr.get_value()), std::chrono::milliseconds(_proxy->get_db().local().get_config().read_request_timeout_in_ms()/2)) :
-            std::chrono::milliseconds(unsigned(sr.get_value()));
+        auto t = std::chrono::milliseconds(unsigned(sr.get_value()));
+        if (sr.get_type() == speculative_retry::type::PERCENTILE) {
+            // Sub-range reads of range scans take much longer than single
+            // partition reads, so they are timed against their own latencies.
+            if (query::is_single_partition(_partition_range)) {
+                t = std::min(_cf->get_coordinator_read_latency_percentile(sr.get_value()), std::chrono::milliseconds(_proxy->get_db().local().get_config().read_request_timeout_in_ms()/2));
+            } else {
+                t = std::min(_cf->get_coordinator_range_read_latency_percentile(sr.get_value()), std::chrono::milliseconds(_proxy->get_db().local().get_config().range_request_timeout_in_ms()/2));
+            }
+        }
         _speculate_timer.arm(t);
 
         // if CL + RR result in covering all replicas, getReadExecutor forces AlwaysSpeculating.  So we know
@@ -5917,7 +5924,31 @@ storage_proxy::query_partition_key_range_concurrent(storage_proxy::clock_type::t
                 throw;
             }
 
-            exec.push_back(::make_shared<never_speculating_read_executor>(schema, cf.shared_from_this(), p, erm, cmd, std::move(range), cl, std::move(filtered_endpoints), trace_state, permit, std::monostate()));
+            // Look for a replica to speculate with, the same way get_read_executor() does.
+            std::optional<gms::inet_address> extra_replica;
+            auto retry_type = schema->speculative_retry().get_type();
+            if (retry_type != speculative_retry::type::NONE && _db.local().get_config().range_read_speculative_retry()) {
+                auto local_dc_filter = erm->get_topology().get_local_dc_filter();
+                for (auto& ep : live_endpoints) {
+                    if (boost::range::find(filtered_endpoints, ep) == filtered_endpoints.end() && (!db::is_datacenter_local(cl) || local_dc_filter(ep))) {
+                        extra_replica = ep;
+                        break;
+                    }
+                }
+            }
+
+            if (!extra_replica) {
+                exec.push_back(::make_shared<never_speculating_read_executor>(schema, cf.shared_from_this(), p, erm, cmd, std::move(range), cl, std::move(filtered_endpoints), trace_state, permit, std::monostate()));
+            } else {
+                auto block_for = filtered_endpoints.size();
+                filtered_endpoints.push_back(*extra_replica);
+                tracing::trace(trace_state, "Added extra target {} for speculative range read", *extra_replica);
+                if (retry_type == speculative_retry::type::ALWAYS) {
+                    exec.push_back(::make_shared<always_speculating_read_executor>(schema, cf.shared_from_this(), p, erm, cmd, std::move(range), cl, block_for, std::move(filtered_endpoints), trace_state, permit, std::monostate()));
+                } else {
+                    exec.push_back(::make_shared<speculating_read_executor>(schema, cf.shared_from_this(), p, erm, cmd, std::move(range), cl, block_for, std::move(filtered_endpoints), trace_state, permit, std::monostate()));
+                }
+            }
             ranges_per_exec.emplace(exec.back().get(), std::move(merged_ranges));
         }
 
@@ -5934,6 +5965,12 @@ storage_proxy::query_partition_key_range_concurrent(storage_proxy::clock_type::t
             co_return error;
         }
 
+        for (auto& e : exec) {
+            if (auto latency = e->max_request_latency()) {
+                e->get_cf()->add_coordinator_range_read_latency(*latency);
+            }
+        }
+
         foreign_ptr<lw_shared_ptr<query::result>> result = std::move(wrapped_result).value();
         result->ensure_counts();
         remaining_row_count -= result->row_count().value();
@@ -5961,6 +5998,30 @@ storage_proxy::query_partition_key_range_concurrent(storage_proxy::clock_type::t
     }
 }
 
+// Upper bound on the initial number of concurrent sub-range reads chosen by
+// estimate_partitions_per_vnode(). Wrong estimates are corrected by the
+// doubling in query_partition_key_range_concurrent() anyway.
+static constexpr uint64_t max_initial_range_concurrency = 64;
+
+// Estimates the number of partitions a vnode range holds, from the
+// sstables of this shard. Returns 0 if there is nothing to go by.
+static double estimate_partitions_per_vnode(const replica::table& table, const locator::effective_replication_map& erm) {
+    uint64_t shard_partitions = 0;
+    for (auto& sst : *table.get_sstables()) {
+        shard_partitions += sst->get_estimated_key_count();
+    }
+    const auto& tm = erm.get_token_metadata();
+    auto owners = tm.count_normal_token_owners();
+    auto rf = erm.get_replication_factor();
+    auto vnodes = tm.sorted_tokens().size();
+    if (!shard_partitions || !owners || !rf || !vnodes) {
+        return 0;
+    }
+    // This node holds rf/owners of the data, so the whole ring holds about
+    // owners/rf times what this node does.
+    return double(shard_partitions) * smp::count * owners / rf / vnodes;
+}
+
 future<result<storage_proxy::coordinator_query_result>>
 storage_proxy::query_partition_key_range(lw_shared_ptr<query::read_command> cmd,
         dht::partition_range_vector partition_ranges,
@@ -5976,8 +6037,18 @@ storage_proxy::query_partition_key_range(lw_shared_ptr<query::read_command> cmd,
 
     query_ranges_to_vnodes_generator ranges_to_vnodes(erm->make_splitter(), schema, std::move(partition_ranges), merge_tokens);
 
-    int result_rows_per_range = 0;
+    double result_rows_per_range = 0;
     int concurrency_factor = 1;
+    if (!merge_tokens && !erm->get_replication_strategy().uses_tablets()) {
+        // Start with enough ranges to fill the page, as estimated from the
+        // local data, instead of crawling sparse tables one vnode at a time.
+        result_rows_per_range = estimate_partitions_per_vnode(table, *erm);
+        if (result_rows_per_range > 0) {
+            // A row limit of n rows is reached by at most n partitions.
+            auto wanted = double(std::min<uint64_t>(cmd->get_row_limit(), cmd->partition_limit));
+            concurrency_factor = std::clamp<double>(std::ceil(wanted / result_rows_per_range), 1, max_initial_range_concurrency);
+        }
+    }
 
     slogger.debug("Estimated result rows per range: {}; requested rows: {}, concurrent range requests: {}",
             result_rows_per_range, cmd->get_row_limit(), concurrency_factor);
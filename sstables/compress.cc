@@ -489,6 +489,10 @@ class compressed_file_data_sink_impl : public data_sink_impl {
     sstables::local_compression _compression;
     size_t _pos = 0;
     uint32_t _full_checksum;
+    // Chunks are compressed into this buffer. output_stream::write() copies
+    // the data it is given before returning, so the same buffer can be
+    // reused for every chunk instead of allocating one per chunk.
+    temporary_buffer<char> _compressed;
 public:
     compressed_file_data_sink_impl(output_stream<char> out, sstables::compression* cm, sstables::local_compression lc)
             : _out(std::move(out))
@@ -503,10 +507,13 @@ class compressed_file_data_sink_impl : public data_sink_impl {
         auto output_len = _compression.compress_max_size(buf.size());
 
         // account space for checksum that goes after compressed data.
-        temporary_buffer<char> compressed(output_len + 4);
+        if (_compressed.size() < output_len + 4) {
+            _compressed = temporary_buffer<char>(output_len + 4);
+        }
+        char* compressed = _compressed.get_write();
 
         // compress flushed data.
-        auto len = _compression.compress(buf.get(), buf.size(), compressed.get_write(), output_len);
+        auto len = _compression.compress(buf.get(), buf.size(), compressed, output_len);
         if (len > output_len) {
             return make_exception_future(std::runtime_error("possible overflow during compression"));
         }
@@ -520,11 +527,11 @@ class compressed_file_data_sink_impl : public data_sink_impl {
         _compression_metadata->set_compressed_file_length(_pos);
 
         // compute 32-bit checksum for compressed data.
-        uint32_t per_chunk_checksum = ChecksumType::checksum(compressed.get(), len);
-        _full_checksum = checksum_combine_or_feed<ChecksumType>(_full_checksum, per_chunk_checksum, compressed.get(), len);
+        uint32_t per_chunk_checksum = ChecksumType::checksum(compressed, len);
+        _full_checksum = checksum_combine_or_feed<ChecksumType>(_full_checksum, per_chunk_checksum, compressed, len);
 
         // write checksum into buffer after compressed data.
-        write_be<uint32_t>(compressed.get_write() + len, per_chunk_checksum);
+        write_be<uint32_t>(compressed + len, per_chunk_checksum);
 
         if constexpr (mode == compressed_checksum_mode::checksum_all) {
             uint32_t be_per_chunk_checksum = cpu_to_be(per_chunk_checksum);
@@ -534,10 +541,7 @@ class compressed_file_data_sink_impl : public data_sink_impl {
 
         _compression_metadata->set_full_checksum(_full_checksum);
 
-        compressed.trim(len + 4);
-
-        auto f = _out.write(compressed.get(), compressed.size());
-        return f.then([compressed = std::move(compressed)] {});
+        return _out.write(compressed, len + 4);
     }
     virtual future<> close() override {
         return _out.close();
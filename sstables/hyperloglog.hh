@@ -49,6 +49,8 @@
 #include <sstream>
 #include <stdexcept>
 #include <algorithm>
+#include <bit>
+#include <span>
 #include <seastar/core/byteorder.hh>
 #include <seastar/core/temporary_buffer.hh>
 
@@ -135,6 +137,22 @@ class HyperLogLog {
         abort();
     }
 
+    /**
+     * Creates an estimator from the registers of another one, as returned
+     * by registers().
+     *
+     * @exception std::invalid_argument the number of registers is not a
+     *            power of two in the range [2^4,2^16].
+     */
+    static HyperLogLog from_registers(std::span<const uint8_t> registers) {
+        if (!std::has_single_bit(registers.size())) {
+            throw std::invalid_argument("number of registers must be a power of two");
+        }
+        HyperLogLog hll(std::countr_zero(registers.size()));
+        std::copy(registers.begin(), registers.end(), hll.M_.begin());
+        return hll;
+    }
+
     /**
      * Adds element to the estimator
      *
@@ -153,11 +171,26 @@ class HyperLogLog {
     }
 #endif
     void offer_hashed(uint64_t hash) {
-        uint32_t index = hash >> (64 - b_);
-        uint8_t rank = rho((hash << b_), 64 - b_);
+        offer_hashed(std::span(M_), hash);
+    }
 
-        if (rank > M_[index]) {
-            M_[index] = rank;
+    /**
+     * Same as offer_hashed(), but updates registers as returned by
+     * registers() in place, without building an estimator from them.
+     *
+     * @exception std::invalid_argument the number of registers is not a
+     *            power of two.
+     */
+    static void offer_hashed(std::span<uint8_t> registers, uint64_t hash) {
+        if (!std::has_single_bit(registers.size())) {
+            throw std::invalid_argument("number of registers must be a power of two");
+        }
+        uint8_t b = std::countr_zero(registers.size());
+        uint32_t index = hash >> (64 - b);
+        uint8_t rank = rho((hash << b), 64 - b);
+
+        if (rank > registers[index]) {
+            registers[index] = rank;
         }
     }
 
@@ -270,6 +303,13 @@ class HyperLogLog {
         return m_;
     }
 
+    /**
+     * Returns the registers.
+     */
+    const std::vector<uint8_t>& registers() const {
+        return M_;
+    }
+
     /**
      * Exchanges the content of the instance
      *
@@ -321,7 +361,7 @@ class HyperLogLog {
     double alphaMM_; ///< alpha * m^2
     std::vector<uint8_t> M_; ///< registers
 
-    uint8_t rho(uint32_t x, uint8_t b) {
+    static uint8_t rho(uint32_t x, uint8_t b) {
         uint8_t v = 1;
         while (v <= b && !(x & 0x80000000)) {
             v++;
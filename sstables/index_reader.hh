@@ -646,6 +646,26 @@ class index_reader {
         return advance_to_end(bound);
     }
 
+    // Returns the index of the first summary entry which is not less than pos,
+    // searching from entry first onwards. pos must not be the minimum or the
+    // maximum position.
+    //
+    // Entries are ordered by token first. Tokens are compared as plain
+    // integers, while comparing keys means decoding the entry's key. So the
+    // search is narrowed down on tokens alone, and keys are only compared
+    // among the entries which share pos's token. Usually there is at most one.
+    uint64_t summary_lower_bound(uint64_t first, dht::ring_position_view pos) const {
+        auto& entries = _sstable->get_summary().entries;
+        const int64_t token = dht::token::to_int64(pos.token());
+        auto lo = std::partition_point(entries.begin() + first, entries.end(), [token] (const summary_entry& e) {
+            return e.raw_token < token;
+        });
+        auto hi = std::partition_point(lo, entries.end(), [token] (const summary_entry& e) {
+            return e.raw_token == token;
+        });
+        return std::distance(entries.begin(), std::lower_bound(lo, hi, pos, index_comparator(*_sstable->_schema)));
+    }
+
     future<> advance_to(index_bound& bound, dht::ring_position_view pos) {
         sstlog.trace("index {} bound {}: advance_to({}), _previous_summary_idx={}, _current_summary_idx={}",
             fmt::ptr(this), fmt::ptr(&bound), pos, bound.previous_summary_idx, bound.current_summary_idx);
@@ -661,9 +681,7 @@ class index_reader {
             return make_ready_future<>();
         }
 
-        auto& summary = _sstable->get_summary();
-        bound.previous_summary_idx = std::distance(std::begin(summary.entries),
-            std::lower_bound(summary.entries.begin() + bound.previous_summary_idx, summary.entries.end(), pos, index_comparator(*_sstable->_schema)));
+        bound.previous_summary_idx = summary_lower_bound(bound.previous_summary_idx, pos);
 
         if (bound.previous_summary_idx == 0) {
             sstlog.trace("index {}: first entry", fmt::ptr(this));
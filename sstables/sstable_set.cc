@@ -324,11 +324,17 @@ std::vector<shared_sstable> partitioned_sstable_set::select(const dht::partition
     auto ipair = query(range);
     auto b = std::move(ipair.first);
     auto e = std::move(ipair.second);
+    auto r = _unleveled_sstables;
+    // Single-key reads hit at most one segment of the interval map, whose
+    // sstables are distinct, so there is nothing to deduplicate.
+    if (b != e && std::next(b) == e) {
+        r.insert(r.end(), b->second.begin(), b->second.end());
+        return r;
+    }
     value_set result;
     while (b != e) {
         boost::copy(b++->second, std::inserter(result, result.end()));
     }
-    auto r = _unleveled_sstables;
     r.insert(r.end(), result.begin(), result.end());
     return r;
 }
@@ -854,6 +860,12 @@ class incremental_reader_selector : public reader_selector {
     }
 };
 
+// Checks whether `pos` falls within the range of partitions covered by `sst`.
+static bool sstable_covers_position(const dht::ring_position& pos, const dht::ring_position_comparator& cmp, const sstable& sst) {
+    return cmp(pos, sst.get_first_decorated_key()) >= 0 &&
+           cmp(pos, sst.get_last_decorated_key()) <= 0;
+}
+
 // The returned function uses the bloom filter to check whether the given sstable
 // may have a partition given by the ring position `pos`.
 //
@@ -864,9 +876,7 @@ class incremental_reader_selector : public reader_selector {
 static std::predicate<const sstable&> auto
 make_pk_filter(const dht::ring_position& pos, const schema& schema) {
     return [&pos, key = utils::make_hashed_key(static_cast<bytes_view>(key::from_partition_key(schema, *pos.key()))), cmp = dht::ring_position_comparator(schema)] (const sstable& sst) {
-        return cmp(pos, sst.get_first_decorated_key()) >= 0 &&
-               cmp(pos, sst.get_last_decorated_key()) <= 0 &&
-               sst.filter_has_key(key);
+        return sstable_covers_position(pos, cmp, sst) && sst.filter_has_key(key);
     };
 }
 
@@ -883,10 +893,24 @@ make_sstable_filter(const dht::ring_position& pos, const schema& schema, const s
 }
 
 // Filter out sstables for reader using bloom filter and supplied predicate
+//
+// The key is hashed once, and the filters of all candidates are probed in
+// two passes: the first one issues prefetches for the filter bits of every
+// sstable whose token range covers the key, the second one tests them. This
+// way the cache misses of probing many filters overlap instead of being
+// taken one sstable at a time.
 static std::vector<shared_sstable>
 filter_sstable_for_reader(std::vector<shared_sstable>&& sstables, const schema& schema, const dht::ring_position& pos, const sstable_predicate& predicate) {
-    auto filter = [_filter = make_sstable_filter(pos, schema, predicate)] (const shared_sstable& sst) { return !_filter(*sst); };
-    sstables.erase(boost::remove_if(sstables, filter), sstables.end());
+    auto key = utils::make_hashed_key(static_cast<bytes_view>(key::from_partition_key(schema, *pos.key())));
+    auto cmp = dht::ring_position_comparator(schema);
+    auto not_in_range = [&] (const shared_sstable& sst) {
+        return !predicate(*sst) || !sstable_covers_position(pos, cmp, *sst);
+    };
+    sstables.erase(boost::remove_if(sstables, not_in_range), sstables.end());
+    for (const auto& sst : sstables) {
+        sst->prefetch_filter(key);
+    }
+    sstables.erase(boost::remove_if(sstables, [&key] (const shared_sstable& sst) { return !sst->filter_has_key(key); }), sstables.end());
     return std::move(sstables);
 }
 
@@ -468,7 +468,7 @@ void write(sstable_version_types v, file_writer& out, const disk_set_of_tagged_u
 }
 
 future<> parse(const schema& schema, sstable_version_types v, random_access_reader& in, summary& s) {
-    using pos_type = typename decltype(summary::positions)::value_type;
+    using pos_type = uint32_t;
 
     co_await parse(schema, v, in, s.header.min_index_interval,
                      s.header.size,
@@ -481,9 +481,12 @@ future<> parse(const schema& schema, sstable_version_types v, random_access_read
 
     // Positions are encoded in little-endian.
     auto b = buf.get();
-    s.positions = utils::chunked_vector<pos_type>();
-    while (s.positions.size() != s.header.size) {
-        s.positions.push_back(seastar::read_le<pos_type>(b));
+    // The positions are only needed to find the boundaries of the entries,
+    // see summary::for_each_position().
+    utils::chunked_vector<pos_type> positions;
+    positions.reserve(s.header.size + 1);
+    while (positions.size() != s.header.size) {
+        positions.push_back(seastar::read_le<pos_type>(b));
         b += sizeof(pos_type);
         co_await coroutine::maybe_yield();
     }
@@ -493,18 +496,18 @@ future<> parse(const schema& schema, sstable_version_types v, random_access_read
     // total memory used by the map, so if we push it to the vector, we
     // can guarantee that no conditionals are used, and we can always
     // query the position of the "next" index.
-    s.positions.push_back(s.header.memory_size);
+    positions.push_back(s.header.memory_size);
 
     co_await in.seek(sizeof(summary::header) + s.header.memory_size);
     co_await parse(schema, v, in, s.first_key, s.last_key);
-    co_await in.seek(s.positions[0] + sizeof(summary::header));
+    co_await in.seek(positions[0] + sizeof(summary::header));
 
     s.entries.reserve(s.header.size);
 
     int idx = 0;
     while (s.entries.size() != s.header.size) {
-        auto pos = s.positions[idx++];
-        auto next = s.positions[idx];
+        auto pos = positions[idx++];
+        auto next = positions[idx];
 
         auto entrysize = next - pos;
         auto buf = co_await in.read_exactly(entrysize);
@@ -519,8 +522,6 @@ future<> parse(const schema& schema, sstable_version_types v, random_access_read
         auto token = schema.get_partitioner().get_token(key_view(key_data));
         s.entries.push_back(summary_entry{ token, key_data, position });
     }
-    // Delete last element which isn't part of the on-disk format.
-    s.positions.pop_back();
 }
 
 inline void write(sstable_version_types v, file_writer& out, const summary_entry& entry) {
@@ -539,10 +540,10 @@ inline void write(sstable_version_types v, file_writer& out, const summary& s) {
                   s.header.memory_size,
                   s.header.sampling_level,
                   s.header.size_at_full_sampling);
-    for (auto&& e : s.positions) {
-        auto p = seastar::cpu_to_le(e);
+    s.for_each_position([&out] (uint32_t pos) {
+        auto p = seastar::cpu_to_le(pos);
         out.write(reinterpret_cast<const char*>(&p), sizeof(p));
-    }
+    });
     write(v, out, s.entries);
     write(v, out, s.first_key, s.last_key);
 }
@@ -1647,9 +1648,7 @@ future<> seal_summary(summary& s,
     }
 
     s.header.memory_size = s.header.size * sizeof(uint32_t);
-    s.positions.reserve(s.entries.size());
     return do_for_each(s.entries, [&s] (summary_entry& e) {
-        s.positions.push_back(s.header.memory_size);
         s.header.memory_size += e.key.size() + sizeof(e.position);
     });
 }
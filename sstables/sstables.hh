@@ -835,6 +835,12 @@ class sstable : public enable_lw_shared_from_this<sstable> {
         return _components->filter->is_present(key);
     }
 
+    // Start bringing in the filter data filter_has_key(key) is going to look
+    // at, without waiting for it.
+    void prefetch_filter(utils::hashed_key key) const {
+        _components->filter->prefetch(key);
+    }
+
     bool filter_has_key(const schema& s, partition_key_view key) const {
         return filter_has_key(key::from_partition_key(s, key));
     }
@@ -161,14 +161,6 @@ struct summary_ka {
         // level would be equal to min_index_interval.
         uint32_t size_at_full_sampling;
     } header;
-    // The position in the Summary file for each of the indexes.
-    // NOTE1 that its actual size is determined by the "size" parameter, not
-    // by its preceding size_at_full_sampling
-    // NOTE2: They are laid out in *MEMORY* order, not BE.
-    // NOTE3: The sizes in this array represent positions in the memory stream,
-    // not the file. The memory stream effectively begins after the header,
-    // so every position here has to be added of sizeof(header).
-    utils::chunked_vector<uint32_t> positions;   // can be large, so use a deque instead of a vector
     utils::chunked_vector<summary_entry> entries;
 
     disk_string<uint32_t> first_key;
@@ -184,12 +176,38 @@ struct summary_ka {
     // However, it was tested that Cassandra loads successfully a Summary file with
     // this structure removed from it. Anyway, let's pay attention to it.
 
+    // The position in the Summary file for each of the indexes.
+    // NOTE1 that its actual size is determined by the "size" parameter, not
+    // by its preceding size_at_full_sampling
+    // NOTE2: They are laid out in *MEMORY* order, not BE.
+    // NOTE3: The sizes in this array represent positions in the memory stream,
+    // not the file. The memory stream effectively begins after the header,
+    // so every position here has to be added of sizeof(header).
+    // NOTE4: The entries are laid out one after another right after the
+    // positions, so the positions follow from the entries and are not kept
+    // in memory.
+    template <typename Func>
+    void for_each_position(Func&& func) const {
+        uint32_t pos = entries.size() * sizeof(uint32_t);
+        for (const auto& e : entries) {
+            func(pos);
+            pos += e.key.size() + sizeof(e.position);
+        }
+    }
+
+    utils::chunked_vector<uint32_t> positions() const {
+        utils::chunked_vector<uint32_t> ret;
+        ret.reserve(entries.size());
+        for_each_position([&ret] (uint32_t pos) { ret.push_back(pos); });
+        return ret;
+    }
+
     /*
      * Returns total amount of memory used by the summary
      * Similar to origin off heap size
      */
     uint64_t memory_footprint() const {
-        auto sz = sizeof(summary_entry) * entries.size() + sizeof(uint32_t) * positions.size() + sizeof(*this);
+        auto sz = sizeof(summary_entry) * entries.size() + sizeof(*this);
         sz += first_key.value.size() + last_key.value.size();
         for (auto& sd : _summary_data) {
             sz += sd.size();
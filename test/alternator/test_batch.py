@@ -52,6 +52,22 @@ def test_batch_write_item_mixed(test_table):
     for item in items:
         assert test_table.get_item(Key={'p': item['p'], 'c': item['c']}, ConsistentRead=True)['Item'] == item
 
+# Test a batch which both puts and deletes different items of the same
+# partition: all of them should take effect, and none should be lost or
+# override another.
+def test_batch_write_and_delete_same_partition(test_table):
+    p = random_string()
+    with test_table.batch_writer() as batch:
+        for i in range(4):
+            batch.put_item({'p': p, 'c': str(i), 'a': i})
+    with test_table.batch_writer() as batch:
+        batch.delete_item(Key={'p': p, 'c': '0'})
+        batch.put_item({'p': p, 'c': '1', 'b': 'x'})
+        batch.delete_item(Key={'p': p, 'c': '2'})
+        batch.put_item({'p': p, 'c': '4', 'a': 4})
+    expected = [{'p': p, 'c': '1', 'b': 'x'}, {'p': p, 'c': '3', 'a': 3}, {'p': p, 'c': '4', 'a': 4}]
+    assert multiset(full_query(test_table, ConsistentRead=True, KeyConditions={'p': {'AttributeValueList': [p], 'ComparisonOperator': 'EQ'}})) == multiset(expected)
+
 # Test batch write to a table with only a hash key
 def test_batch_write_hash_only(test_table_s):
     items = [{'p': random_string(), 'val': random_string()} for i in range(10)]
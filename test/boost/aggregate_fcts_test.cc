@@ -224,6 +224,28 @@ SEASTAR_TEST_CASE(test_aggregate_count) {
     });
 }
 
+SEASTAR_TEST_CASE(test_aggregate_approx_count_distinct) {
+    return do_with_cql_env_thread([&] (auto& e) {
+        e.execute_cql("CREATE TABLE test(a int primary key, b int, c text)").get();
+        for (int i = 0; i < 1000; ++i) {
+            e.execute_cql(format("INSERT INTO test(a, b) VALUES ({}, {})", i, i % 10)).get();
+        }
+
+        auto msg = e.execute_cql("SELECT approx_count_distinct(a), approx_count_distinct(b), approx_count_distinct(c) FROM test").get();
+        assert_that(msg).is_rows().with_size(1);
+        auto row = dynamic_cast<cql_transport::messages::result_message::rows&>(*msg).rs().result_set().rows().front();
+        auto estimate = [&] (size_t i) {
+            return value_cast<int64_t>(long_type->deserialize(*row[i]));
+        };
+        BOOST_REQUIRE_GE(estimate(0), 900);
+        BOOST_REQUIRE_LE(estimate(0), 1100);
+        BOOST_REQUIRE_GE(estimate(1), 9);
+        BOOST_REQUIRE_LE(estimate(1), 11);
+        // Nulls are not counted.
+        BOOST_REQUIRE_EQUAL(estimate(2), 0);
+    });
+}
+
 SEASTAR_TEST_CASE(test_reverse_type_aggregation) {
     return do_with_cql_env_thread([&] (auto& e) {
         e.execute_cql("CREATE TABLE test(p int, c timestamp, v int, primary key (p, c)) with clustering order by (c desc)").get();
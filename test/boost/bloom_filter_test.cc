@@ -223,3 +223,27 @@ SEASTAR_TEST_CASE(test_bloom_filters_with_bad_partition_estimate) {
         }
     });
 };
+
+SEASTAR_TEST_CASE(test_bloom_filter_probe_with_many_hashes) {
+    return seastar::async([] {
+        // is_present() batches up to a fixed number of probes, and falls back
+        // to probing one bit at a time above it. Exercise both paths.
+        for (auto hashes : {1, 7, 32, 33, 64}) {
+            auto filter = utils::filter::create_filter(hashes, 1000, 10, utils::filter_format::m_format);
+            std::vector<bytes> keys;
+            for (int i = 0; i < 1000; ++i) {
+                keys.push_back(to_bytes(format("key{}", i)));
+            }
+            for (const auto& k : keys) {
+                filter->add(bytes_view(k));
+            }
+            for (const auto& k : keys) {
+                BOOST_REQUIRE(filter->is_present(bytes_view(k)));
+            }
+            filter->clear();
+            for (const auto& k : keys) {
+                BOOST_REQUIRE(!filter->is_present(bytes_view(k)));
+            }
+        }
+    });
+}
@@ -37,6 +37,7 @@
 #include "db/commitlog/rp_set.hh"
 #include "db/extensions.hh"
 #include "readers/combined.hh"
+#include "schema/schema_builder.hh"
 #include "log.hh"
 #include "test/lib/exception_utils.hh"
 #include "test/lib/cql_test_env.hh"
@@ -45,6 +46,8 @@
 #include "test/lib/mutation_source_test.hh"
 #include "test/lib/key_utils.hh"
 #include "test/lib/test_utils.hh"
+#include "test/lib/random_utils.hh"
+#include "utils/base64.hh"
 
 using namespace db;
 
@@ -1037,6 +1040,109 @@ SEASTAR_TEST_CASE(test_commitlog_add_entry) {
     });
 }
 
+SEASTAR_TEST_CASE(test_commitlog_add_compressed_entry) {
+    commitlog::config cfg;
+    cfg.allow_compressed_entries = true;
+    return cl_test(cfg, [](commitlog& log) {
+        return seastar::async([&] {
+            auto s = schema_builder("ks", "cf")
+                    .with_column("pk", bytes_type, column_kind::partition_key)
+                    .with_column("v", bytes_type)
+                    .build();
+            auto pk = partition_key::from_single_value(*s, to_bytes("key"));
+
+            // Big enough to be compressed in several chunks.
+            mutation m(s, pk);
+            m.set_clustered_cell(clustering_key::make_empty(), "v", data_value(bytes(3 * commitlog_entry_writer::compressed_chunk_size + 100, 'x')), api::new_timestamp());
+            auto fm = freeze(m);
+
+            mutation small(s, pk);
+            small.set_clustered_cell(clustering_key::make_empty(), "v", data_value(bytes(16, 'x')), api::new_timestamp());
+            auto small_fm = freeze(small);
+
+            commitlog_entry_writer cew(s, fm, commitlog::force_sync::no, compressor::lz4);
+            BOOST_REQUIRE(cew.compressed());
+            BOOST_REQUIRE_LT(cew.size(), fm.representation().size());
+            commitlog_entry_writer small_cew(s, small_fm, commitlog::force_sync::no, compressor::lz4);
+            BOOST_REQUIRE(!small_cew.compressed());
+
+            auto rp = log.add_entry(s->id(), cew, db::timeout_clock::now() + 60s).get().release();
+            auto small_rp = log.add_entry(s->id(), small_cew, db::timeout_clock::now() + 60s).get().release();
+            log.sync_all_segments().get();
+
+            size_t found = 0;
+            for (auto& seg : log.get_active_segment_names()) {
+                // Older versions must refuse to replay segments which may hold compressed entries.
+                BOOST_REQUIRE_EQUAL(commitlog::descriptor(seg).ver, commitlog::descriptor::segment_version_4);
+                db::commitlog::read_log_file(seg, db::commitlog::descriptor::FILENAME_PREFIX, [&](db::commitlog::buffer_and_replay_position buf_rp) {
+                    if (buf_rp.position == rp || buf_rp.position == small_rp) {
+                        commitlog_entry_reader r(buf_rp.buffer);
+                        BOOST_CHECK_EQUAL(r.mutation().unfreeze(s), buf_rp.position == rp ? m : small);
+                        ++found;
+                    }
+                    return make_ready_future<>();
+                }).get();
+            }
+            BOOST_CHECK_EQUAL(found, 2);
+        });
+    });
+}
+
+// Replay recreates the compressor of a compressed entry from its name
+// alone, so an entry must only be compressed if that is enough to read it.
+SEASTAR_TEST_CASE(test_commitlog_replay_zstd_compressed_entries) {
+    commitlog::config cfg;
+    cfg.allow_compressed_entries = true;
+    return cl_test(cfg, [](commitlog& log) {
+        return seastar::async([&] {
+            auto s = schema_builder("ks", "cf")
+                    .with_column("pk", bytes_type, column_kind::partition_key)
+                    .with_column("v", bytes_type)
+                    .build();
+            auto pk = partition_key::from_single_value(*s, to_bytes("key"));
+
+            auto dict = tests::random::get_bytes(4096);
+            auto make_zstd = [] (std::map<sstring, sstring> opts) {
+                opts.emplace(compression_parameters::SSTABLE_COMPRESSION, "org.apache.cassandra.io.compress.ZstdCompressor");
+                return compression_parameters(opts).get_compressor();
+            };
+            auto with_level = make_zstd({{"compression_level", "7"}});
+            auto with_dict = make_zstd({{"dictionary", sstring(base64_encode(dict))}});
+            BOOST_REQUIRE(!with_level->uncompress_depends_on_options());
+            BOOST_REQUIRE(with_dict->uncompress_depends_on_options());
+
+            mutation m(s, pk);
+            auto value = dict;
+            value += bytes(16 * 1024, 'x');
+            m.set_clustered_cell(clustering_key::make_empty(), "v", data_value(value), api::new_timestamp());
+            auto fm = freeze(m);
+
+            commitlog_entry_writer level_cew(s, fm, commitlog::force_sync::no, with_level);
+            BOOST_REQUIRE(level_cew.compressed());
+            commitlog_entry_writer dict_cew(s, fm, commitlog::force_sync::no, with_dict);
+            BOOST_REQUIRE(!dict_cew.compressed());
+
+            std::vector<replay_position> rps;
+            rps.push_back(log.add_entry(s->id(), level_cew, db::timeout_clock::now() + 60s).get().release());
+            rps.push_back(log.add_entry(s->id(), dict_cew, db::timeout_clock::now() + 60s).get().release());
+            log.sync_all_segments().get();
+
+            size_t found = 0;
+            for (auto& seg : log.get_active_segment_names()) {
+                db::commitlog::read_log_file(seg, db::commitlog::descriptor::FILENAME_PREFIX, [&](db::commitlog::buffer_and_replay_position buf_rp) {
+                    if (std::ranges::find(rps, buf_rp.position) != rps.end()) {
+                        commitlog_entry_reader r(buf_rp.buffer);
+                        BOOST_CHECK_EQUAL(r.mutation().unfreeze(s), m);
+                        ++found;
+                    }
+                    return make_ready_future<>();
+                }).get();
+            }
+            BOOST_CHECK_EQUAL(found, rps.size());
+        });
+    });
+}
+
 SEASTAR_TEST_CASE(test_commitlog_add_entries) {
     return cl_test([](commitlog& log) {
         return seastar::async([&] {
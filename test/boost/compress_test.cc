@@ -6,11 +6,15 @@
  * SPDX-License-Identifier: AGPL-3.0-or-later
  */
 
-#define BOOST_TEST_MODULE core
-
 #include <boost/test/unit_test.hpp>
+#include "test/lib/scylla_test_case.hh"
+#include <seastar/testing/thread_test_case.hh>
 
 #include "sstables/compress.hh"
+#include "compress.hh"
+#include "exceptions/exceptions.hh"
+#include "utils/base64.hh"
+#include "test/lib/random_utils.hh"
 
 BOOST_AUTO_TEST_CASE(segmented_offsets_basic_functionality) {
     sstables::compression::segmented_offsets offsets;
@@ -143,3 +147,57 @@ BOOST_AUTO_TEST_CASE(segmented_offsets_corner_cases) {
     BOOST_REQUIRE(accessor.at(4079) == 4079);
     BOOST_REQUIRE(accessor.at(4080) == 4080);
 }
+
+static const sstring zstd_name = "org.apache.cassandra.io.compress.ZstdCompressor";
+
+static compressor_ptr make_zstd(std::optional<sstring> dictionary) {
+    std::map<sstring, sstring> opts{{compression_parameters::SSTABLE_COMPRESSION, zstd_name}};
+    if (dictionary) {
+        opts.emplace("dictionary", *dictionary);
+    }
+    return compression_parameters(opts).get_compressor();
+}
+
+static bytes zstd_compress(const compressor& c, bytes_view input) {
+    bytes out(bytes::initialized_later(), c.compress_max_size(input.size()));
+    auto len = c.compress(reinterpret_cast<const char*>(input.data()), input.size(), reinterpret_cast<char*>(out.data()), out.size());
+    return bytes(out.begin(), out.begin() + len);
+}
+
+static bytes zstd_uncompress(const compressor& c, bytes_view input, size_t output_len) {
+    bytes out(bytes::initialized_later(), output_len);
+    auto len = c.uncompress(reinterpret_cast<const char*>(input.data()), input.size(), reinterpret_cast<char*>(out.data()), out.size());
+    BOOST_REQUIRE_EQUAL(len, output_len);
+    return out;
+}
+
+SEASTAR_THREAD_TEST_CASE(zstd_dictionary_round_trip) {
+    auto dict = tests::random::get_bytes(4096);
+    auto encoded = sstring(base64_encode(dict));
+    // Input mostly made of the dictionary contents, so that it compresses
+    // much better with the dictionary than without.
+    auto input = dict;
+    input += bytes(size_t(100), int8_t(0));
+
+    auto with_dict = make_zstd(encoded);
+    BOOST_REQUIRE_EQUAL(with_dict->options().at("dictionary"), encoded);
+    auto compressed = zstd_compress(*with_dict, input);
+    BOOST_REQUIRE_LT(compressed.size(), zstd_compress(*make_zstd(std::nullopt), input).size());
+
+    // A second compressor with the same dictionary can read the data.
+    BOOST_REQUIRE_EQUAL(zstd_uncompress(*make_zstd(encoded), compressed, input.size()), input);
+    BOOST_REQUIRE_EQUAL(zstd_uncompress(*with_dict, compressed, input.size()), input);
+
+    // Without the dictionary it can't.
+    BOOST_REQUIRE_THROW(zstd_uncompress(*make_zstd(std::nullopt), compressed, input.size()), std::runtime_error);
+}
+
+SEASTAR_THREAD_TEST_CASE(zstd_dictionary_invalid) {
+    BOOST_REQUIRE_THROW(make_zstd(sstring("not base64!")), exceptions::configuration_exception);
+
+    auto oversize = sstring(base64_encode(tests::random::get_bytes(32 * 1024 + 1)));
+    BOOST_REQUIRE_THROW(make_zstd(oversize), exceptions::configuration_exception);
+
+    auto max_size = sstring(base64_encode(tests::random::get_bytes(32 * 1024)));
+    BOOST_REQUIRE_NO_THROW(make_zstd(max_size));
+}
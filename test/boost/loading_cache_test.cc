@@ -26,6 +26,7 @@
 #include "test/lib/log.hh"
 #include "test/lib/random_utils.hh"
 #include "test/lib/cql_test_env.hh"
+#include "test/lib/cql_assertions.hh"
 
 #include <vector>
 #include <numeric>
@@ -851,3 +852,37 @@ SEASTAR_TEST_CASE(test_prepared_statement_small_cache) {
         }        
     }, small_cache_config);
 }
+
+SEASTAR_TEST_CASE(test_unprepared_statement_cache) {
+    constexpr auto CACHE_SIZE = 950000;
+
+    cql_test_config cfg;
+    cfg.qp_mcfg = {CACHE_SIZE, CACHE_SIZE, CACHE_SIZE};
+    return do_with_cql_env_thread([](cql_test_env& e) {
+        e.execute_cql("CREATE TABLE tbl1 (a int, b int, PRIMARY KEY (a))").get();
+        e.execute_cql("INSERT INTO tbl1 (a, b) VALUES (1, 2)").get();
+
+        auto& stats = cql3::unprepared_statements_cache::shard_stats();
+
+        // The first execution parses the statement, the second one is served
+        // from the cache.
+        auto misses = stats.misses;
+        auto hits = stats.hits;
+        for (int i = 0; i < 2; i++) {
+            assert_that(e.execute_cql("SELECT * FROM tbl1 WHERE a = 1").get())
+                .is_rows().with_rows({{int32_type->decompose(1), int32_type->decompose(2)}});
+        }
+        BOOST_REQUIRE_EQUAL(stats.misses, misses + 1);
+        BOOST_REQUIRE_EQUAL(stats.hits, hits + 1);
+
+        // Schema changes must invalidate cached statements, so the statement
+        // is parsed again.
+        e.execute_cql("ALTER TABLE tbl1 ADD c int").get();
+        misses = stats.misses;
+        hits = stats.hits;
+        assert_that(e.execute_cql("SELECT * FROM tbl1 WHERE a = 1").get())
+            .is_rows().with_rows({{int32_type->decompose(1), int32_type->decompose(2), std::nullopt}});
+        BOOST_REQUIRE_EQUAL(stats.misses, misses + 1);
+        BOOST_REQUIRE_EQUAL(stats.hits, hits);
+    }, std::move(cfg));
+}
@@ -229,6 +229,69 @@ SEASTAR_TEST_CASE(test_memtable_flush_reader) {
     });
 }
 
+SEASTAR_THREAD_TEST_CASE(test_memtable_flush_ranges) {
+    simple_schema ss;
+    tests::reader_concurrency_semaphore_wrapper semaphore;
+
+    auto make_memtable = [&] (const std::vector<dht::decorated_key>& keys) {
+        auto mt = make_lw_shared<replica::memtable>(ss.schema());
+        for (const auto& dk : keys) {
+            mutation m(ss.schema(), dk);
+            ss.add_row(m, ss.make_ckey(0), "v");
+            mt->apply(m);
+        }
+        return mt;
+    };
+
+    // Every range has to produce at least one partition, as the sstable
+    // writer can't seal an empty sstable, and together the ranges have to
+    // produce every partition exactly once.
+    auto check_flush_ranges = [&] (const std::vector<dht::decorated_key>& keys, uint32_t parallelism, size_t expected_ranges) {
+        auto mt = make_memtable(keys);
+        auto ranges = mt->flush_ranges(parallelism, 1);
+        BOOST_REQUIRE_EQUAL(ranges.size(), expected_ranges);
+
+        std::vector<dht::decorated_key> flushed;
+        for (const auto& r : ranges) {
+            auto rd = mt->make_flush_reader(ss.schema(), semaphore.make_permit(), r);
+            auto close_rd = deferred_close(rd);
+            size_t partitions = 0;
+            while (auto mo = read_mutation_from_mutation_reader(rd).get()) {
+                flushed.push_back(mo->decorated_key());
+                ++partitions;
+            }
+            BOOST_REQUIRE_GT(partitions, 0);
+        }
+        BOOST_REQUIRE_EQUAL(flushed.size(), keys.size());
+        for (size_t i = 0; i < keys.size(); ++i) {
+            BOOST_REQUIRE(flushed[i].equal(*ss.schema(), keys[i]));
+        }
+    };
+
+    auto keys = ss.make_pkeys(64);
+
+    testlog.info("Single range");
+    check_flush_ranges(keys, 1, 1);
+
+    testlog.info("Whole ring");
+    check_flush_ranges(keys, 4, 4);
+
+    testlog.info("Parallelism is rounded down to a power of two");
+    check_flush_ranges(keys, 3, 2);
+
+    testlog.info("Memtable covering only a part of the ring");
+    std::vector<dht::decorated_key> first_half;
+    std::ranges::copy_if(keys, std::back_inserter(first_half), [] (const dht::decorated_key& dk) {
+        return dht::token::to_int64(dk.token()) < 0;
+    });
+    check_flush_ranges(first_half, 4, 2);
+    check_flush_ranges({keys.front()}, 16, 1);
+
+    testlog.info("Memtable too small to be split");
+    auto mt = make_memtable(keys);
+    BOOST_REQUIRE_EQUAL(mt->flush_ranges(4, mt->occupancy().used_space()).size(), 1);
+}
+
 SEASTAR_TEST_CASE(test_adding_a_column_during_reading_doesnt_affect_read_result) {
     return seastar::async([] {
         auto common_builder = schema_builder("ks", "cf")
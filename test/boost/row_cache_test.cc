@@ -625,6 +625,95 @@ SEASTAR_TEST_CASE(test_single_key_queries_after_population_in_reverse_order) {
     });
 }
 
+SEASTAR_TEST_CASE(test_hot_partition_keys_and_repopulation) {
+    return seastar::async([] {
+        auto s = make_schema();
+        tests::reader_concurrency_semaphore_wrapper semaphore;
+
+        std::vector<mutation> mutations = make_ring(s, 5);
+        auto mt = make_memtable(s, mutations);
+
+        cache_tracker tracker;
+        row_cache cache(s, snapshot_source_from_snapshot(mt->as_data_source()), tracker);
+
+        // Another table sharing the LRU.
+        auto s2 = make_schema();
+        std::vector<mutation> mutations2 = make_ring(s2, 2);
+        auto mt2 = make_memtable(s2, mutations2);
+        row_cache cache2(s2, snapshot_source_from_snapshot(mt2->as_data_source()), tracker);
+
+        BOOST_REQUIRE(cache.hot_partition_keys(10).get().empty());
+
+        for (auto i : {1, 3, 4}) {
+            verify_has(cache, mutations[i]);
+            verify_has(cache2, mutations2[0]);
+        }
+        verify_has(cache, mutations[1]);
+
+        auto keys = cache.hot_partition_keys(10).get();
+        BOOST_REQUIRE_EQUAL(keys.size(), 3);
+        BOOST_REQUIRE(keys[0].equal(*s, mutations[1].decorated_key()));
+        BOOST_REQUIRE(keys[1].equal(*s, mutations[4].decorated_key()));
+        BOOST_REQUIRE(keys[2].equal(*s, mutations[3].decorated_key()));
+        auto first = cache.hot_partition_keys(2).get();
+        BOOST_REQUIRE_EQUAL(first.size(), 2);
+        BOOST_REQUIRE(first[1].equal(*s, mutations[4].decorated_key()));
+        BOOST_REQUIRE_EQUAL(cache2.hot_partition_keys(10).get().size(), 1);
+
+        tracker.clear();
+        BOOST_REQUIRE(cache.hot_partition_keys(10).get().empty());
+
+        cache.populate_from_underlying(keys, semaphore.make_permit()).get();
+        // Populated in the given order, so the last one is the most recent.
+        auto repopulated = cache.hot_partition_keys(10).get();
+        BOOST_REQUIRE_EQUAL(repopulated.size(), keys.size());
+        for (size_t i = 0; i < keys.size(); ++i) {
+            BOOST_REQUIRE(repopulated[i].equal(*s, keys[keys.size() - 1 - i]));
+        }
+        auto misses = tracker.get_stats().partition_misses;
+        for (auto i : {1, 3, 4}) {
+            verify_has(cache, mutations[i]);
+        }
+        BOOST_REQUIRE_EQUAL(tracker.get_stats().partition_misses, misses);
+    });
+}
+
+SEASTAR_TEST_CASE(test_frequent_only_admission) {
+    return seastar::async([] {
+        auto s = schema_builder(make_schema())
+            .set_caching_options(caching_options::from_map({{"admission", "FREQUENT"}}))
+            .build();
+        tests::reader_concurrency_semaphore_wrapper semaphore;
+
+        std::vector<mutation> mutations = make_ring(s, 3);
+        auto mt = make_memtable(s, mutations);
+
+        cache_tracker tracker;
+        row_cache cache(s, snapshot_source_from_snapshot(mt->as_data_source()), tracker);
+
+        // A partition read for the first time is not inserted.
+        verify_has(cache, mutations[0]);
+        BOOST_REQUIRE(cache.hot_partition_keys(10).get().empty());
+        BOOST_REQUIRE_EQUAL(tracker.get_stats().partitions_not_admitted, 1);
+
+        // The second read inserts it, the third one hits.
+        verify_has(cache, mutations[0]);
+        BOOST_REQUIRE_EQUAL(cache.hot_partition_keys(10).get().size(), 1);
+        auto misses = tracker.get_stats().partition_misses;
+        verify_has(cache, mutations[0]);
+        BOOST_REQUIRE_EQUAL(tracker.get_stats().partition_misses, misses);
+
+        // A scan reads everything but inserts only what was read before.
+        assert_that(cache.make_reader(s, semaphore.make_permit()))
+            .produces(mutations[0])
+            .produces(mutations[1])
+            .produces(mutations[2])
+            .produces_end_of_stream();
+        BOOST_REQUIRE_EQUAL(cache.hot_partition_keys(10).get().size(), 1);
+        BOOST_REQUIRE_EQUAL(tracker.get_stats().partitions_not_admitted, 3);
+    });
+}
+
 // Reproducer for https://github.com/scylladb/scylla/issues/4236
 SEASTAR_TEST_CASE(test_partition_range_population_with_concurrent_memtable_flushes) {
     return seastar::async([] {
@@ -1772,6 +1861,39 @@ SEASTAR_TEST_CASE(test_lru) {
     });
 }
 
+SEASTAR_TEST_CASE(test_low_priority_rows_are_not_refreshed_by_reads) {
+    return seastar::async([] {
+        auto s = make_schema();
+        auto s_low = schema_builder(make_schema())
+            .set_caching_options(caching_options::from_map({{"priority", "LOW"}}))
+            .build();
+
+        auto m = make_ring(s, 1).front();
+        auto m_low = make_ring(s_low, 1).front();
+        auto mt = make_memtable(s, {m});
+        auto mt_low = make_memtable(s_low, {m_low});
+
+        cache_tracker tracker;
+        row_cache cache(s, snapshot_source_from_snapshot(mt->as_data_source()), tracker);
+        row_cache cache_low(s_low, snapshot_source_from_snapshot(mt_low->as_data_source()), tracker);
+
+        cache_low.populate(m_low);
+        cache.populate(m);
+
+        // The partition of the low priority table is the least recently
+        // used one even after it is read.
+        verify_has(cache, m);
+        verify_has(cache_low, m_low);
+        evict_one_partition(tracker);
+
+        auto misses = tracker.get_stats().partition_misses;
+        verify_has(cache, m);
+        BOOST_REQUIRE_EQUAL(tracker.get_stats().partition_misses, misses);
+        verify_has(cache_low, m_low);
+        BOOST_REQUIRE_EQUAL(tracker.get_stats().partition_misses, misses + 1);
+    });
+}
+
 SEASTAR_TEST_CASE(test_update_invalidating) {
     return seastar::async([] {
         simple_schema s;
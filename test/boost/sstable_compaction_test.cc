@@ -2153,6 +2153,44 @@ SEASTAR_THREAD_TEST_CASE(sstable_scrub_validate_mode_test_valid_sstable) {
     });
 }
 
+SEASTAR_THREAD_TEST_CASE(sstable_scrub_validate_mode_test_corrupt_checksums) {
+    // Overwrites the first bytes of the component with garbage.
+    auto corrupt = [] (sstables::shared_sstable sst, component_type component, uint64_t pos) {
+        auto f = open_file_dma(test(sst).filename(component).native(), open_flags::wo).get();
+        auto close_f = defer([&f] { f.close().get(); });
+        const auto size = f.disk_write_dma_alignment();
+        auto buf = temporary_buffer<char>::aligned(f.disk_write_dma_alignment(), size);
+        std::fill(buf.get_write(), buf.get_write() + size, 'x');
+        f.dma_write(align_down(pos, size), buf.begin(), buf.size()).get();
+    };
+
+    // A data file not matching its checksums, and a digest which can't even be parsed.
+    for (auto component : {component_type::Data, component_type::Digest}) {
+        scrub_test_framework test;
+
+        auto schema = test.schema();
+        auto muts = tests::generate_random_mutations(test.random_schema()).get();
+
+        test.run(schema, muts, [&] (table_for_tests& table, compaction::table_state& ts, std::vector<sstables::shared_sstable> sstables) {
+            BOOST_REQUIRE(sstables.size() == 1);
+            auto sst = sstables.front();
+
+            testlog.info("Corrupting {} of {}", component, sst->get_filename());
+            corrupt(sst, component, component == component_type::Data ? sst->ondisk_data_size() / 2 : 0);
+
+            sstables::compaction_type_options::scrub opts = {
+                .operation_mode = sstables::compaction_type_options::scrub::mode::validate,
+            };
+            auto stats = table->get_compaction_manager().perform_sstable_scrub(ts, opts).get();
+
+            BOOST_REQUIRE(stats);
+            BOOST_REQUIRE_GT(stats->validation_errors, 0);
+            BOOST_REQUIRE(sst->is_quarantined());
+            BOOST_REQUIRE(in_strategy_sstables(ts).empty());
+        });
+    }
+}
+
 SEASTAR_TEST_CASE(sstable_validate_test) {
   return test_env::do_with_async([] (test_env& env) {
     auto schema = schema_builder("ks", get_name())
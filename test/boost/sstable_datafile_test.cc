@@ -100,7 +100,7 @@ SEASTAR_TEST_CASE(datafile_generation_09) {
         summary& sst2_s = sstables::test(sst2).get_summary();
 
         BOOST_REQUIRE(::memcmp(&sst1_s.header, &sst2_s.header, sizeof(summary::header)) == 0);
-        BOOST_REQUIRE(sst1_s.positions == sst2_s.positions);
+        BOOST_REQUIRE(sst1_s.positions() == sst2_s.positions());
         BOOST_REQUIRE(sst1_s.entries == sst2_s.entries);
         BOOST_REQUIRE(sst1_s.first_key.value == sst2_s.first_key.value);
         BOOST_REQUIRE(sst1_s.last_key.value == sst2_s.last_key.value);
@@ -2313,7 +2313,7 @@ SEASTAR_TEST_CASE(summary_rebuild_sanity) {
         summary& s2 = sstables::test(sst).get_summary();
 
         BOOST_REQUIRE(::memcmp(&s1.header, &s2.header, sizeof(summary::header)) == 0);
-        BOOST_REQUIRE(s1.positions == s2.positions);
+        BOOST_REQUIRE(s1.positions() == s2.positions());
         BOOST_REQUIRE(s1.entries == s2.entries);
         BOOST_REQUIRE(s1.first_key.value == s2.first_key.value);
         BOOST_REQUIRE(s1.last_key.value == s2.last_key.value);
@@ -157,7 +157,7 @@ SEASTAR_TEST_CASE(missing_summary_first_last_sane) {
     return test_using_reusable_sst(uncompressed_schema(), uncompressed_dir(), 2, [] (test_env& env, shared_sstable ptr) {
         auto& summary = sstables::test(ptr).get_summary();
         BOOST_REQUIRE(summary.header.size == 1);
-        BOOST_REQUIRE(summary.positions.size() == 1);
+        BOOST_REQUIRE(summary.positions().size() == 1);
         BOOST_REQUIRE(summary.entries.size() == 1);
         BOOST_REQUIRE(bytes_view(summary.first_key) == as_bytes("vinna"));
         BOOST_REQUIRE(bytes_view(summary.last_key) == as_bytes("finna"));
@@ -217,7 +217,7 @@ SEASTAR_TEST_CASE(check_summary_func) {
             summary& sst2_s = sstables::test(sst2).get_summary();
 
             BOOST_REQUIRE(::memcmp(&sst1_s.header, &sst2_s.header, sizeof(summary::header)) == 0);
-            BOOST_REQUIRE(sst1_s.positions == sst2_s.positions);
+            BOOST_REQUIRE(sst1_s.positions() == sst2_s.positions());
             BOOST_REQUIRE(sst1_s.entries == sst2_s.entries);
             BOOST_REQUIRE(sst1_s.first_key.value == sst2_s.first_key.value);
             BOOST_REQUIRE(sst1_s.last_key.value == sst2_s.last_key.value);
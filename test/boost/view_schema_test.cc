@@ -127,6 +127,35 @@ SEASTAR_TEST_CASE(test_column_dropped_from_base) {
     });
 }
 
+SEASTAR_TEST_CASE(test_skip_read_before_write_for_new_partitions) {
+    cql_test_config cfg;
+    cfg.db_config->view_update_skip_read_for_new_partitions.set(true);
+    return do_with_cql_env_thread([] (auto& e) {
+        e.execute_cql("create table cf (p int, c int, v int, primary key (p, c));").get();
+        e.execute_cql("create materialized view vcf as select * from cf "
+                      "where v is not null and p is not null and c is not null "
+                      "primary key (v, p, c)").get();
+        auto check_view = [&] (int v) {
+            eventually([&] {
+                auto msg = e.execute_cql("select v, p, c from vcf").get();
+                assert_that(msg).is_rows().with_rows({
+                    {int32_type->decompose(v), int32_type->decompose(0), int32_type->decompose(0)},
+                });
+            });
+        };
+        // A new partition, the read is skipped.
+        e.execute_cql("insert into cf (p, c, v) values (0, 0, 1);").get();
+        check_view(1);
+        // The partition is in a memtable, so the old view row is found and deleted.
+        e.execute_cql("insert into cf (p, c, v) values (0, 0, 2);").get();
+        check_view(2);
+        // The same, with the partition in an sstable.
+        e.local_db().flush_all_memtables().get();
+        e.execute_cql("insert into cf (p, c, v) values (0, 0, 3);").get();
+        check_view(3);
+    }, std::move(cfg));
+}
+
 SEASTAR_TEST_CASE(test_updates) {
     return do_with_cql_env_thread([] (auto& e) {
         e.execute_cql("create table base (k int, v int, primary key (k));").get();
@@ -16,6 +16,7 @@
 #include "test/lib/alternator_test_env.hh"
 #include "test/perf/perf.hh"
 #include <seastar/core/app-template.hh>
+#include <seastar/core/sleep.hh>
 #include <seastar/testing/test_runner.hh>
 #include "test/lib/random_utils.hh"
 
@@ -25,6 +26,7 @@
 #include <fstream>
 #include "service/storage_proxy.hh"
 #include "cql3/query_processor.hh"
+#include "compaction/compaction_manager.hh"
 #include "db/config.hh"
 #include "db/extensions.hh"
 #include "db/tags/extension.hh"
@@ -77,6 +79,8 @@ struct test_config {
     sstring timeout;
     bool bypass_cache;
     std::optional<unsigned> initial_tablets;
+    bool sustained_write = false;
+    unsigned write_rate = 0;
 };
 
 std::ostream& operator<<(std::ostream& os, const test_config::run_mode& m) {
@@ -103,6 +107,8 @@ std::ostream& operator<<(std::ostream& os, const test_config& cfg) {
            << ", frontend=" << cfg.frontend
            << ", query_single_key=" << (cfg.query_single_key ? "yes" : "no")
            << ", counters=" << (cfg.counters ? "yes" : "no")
+           << ", sustained_write=" << (cfg.sustained_write ? "yes" : "no")
+           << ", write_rate=" << cfg.write_rate
            << "}";
 }
 
@@ -151,25 +157,124 @@ static std::vector<perf_result> test_read(cql_test_env& env, test_config& cfg) {
         }, cfg.concurrency, cfg.duration_in_seconds, cfg.operations_per_shard, cfg.stop_on_error);
 }
 
-static std::vector<perf_result> test_write(cql_test_env& env, test_config& cfg) {
+static sstring make_write_query(const test_config& cfg) {
     sstring usings;
     if (!cfg.timeout.empty()) {
         usings += "USING TIMEOUT " + cfg.timeout;
     }
-    sstring query = format("UPDATE cf {}SET "
+    return format("UPDATE cf {}SET "
             "\"C0\" = 0x8f75da6b3dcec90c8a404fb9a5f6b0621e62d39c69ba5758e5f41b78311fbb26cc7a,"
             "\"C1\" = 0xa8761a2127160003033a8f4f3d1069b7833ebe24ef56b3beee728c2b686ca516fa51,"
             "\"C2\" = 0x583449ce81bfebc2e1a695eb59aad5fcc74d6d7311fc6197b10693e1a161ca2e1c64,"
             "\"C3\" = 0x62bcb1dbc0ff953abc703bcb63ea954f437064c0c45366799658bd6b91d0f92908d7,"
             "\"C4\" = 0x222fcbe31ffa1e689540e1499b87fa3f9c781065fccd10e4772b4c7039c2efd0fb27 "
             "WHERE \"KEY\" = ?", usings);
-    auto id = env.prepare(query).get();
+}
+
+static std::vector<perf_result> test_write(cql_test_env& env, test_config& cfg) {
+    auto id = env.prepare(make_write_query(cfg)).get();
     return time_parallel([&env, &cfg, id] {
             bytes key = make_random_key(cfg);
             return env.execute_prepared(id, {{cql3::raw_value::make_value(std::move(key))}}).discard_result();
         }, cfg.concurrency, cfg.duration_in_seconds, cfg.operations_per_shard, cfg.stop_on_error);
 }
 
+// Per-shard state of the sustained write test.
+struct sustained_write_state {
+    using clk = std::chrono::steady_clock;
+    utils::time_estimated_histogram latency;
+    // Start time of the next write when running at a fixed rate. Only the
+    // default at the start of the run, so that a backlog carries over
+    // between reporting intervals.
+    clk::time_point next_at;
+};
+
+struct write_path_stats {
+    size_t dirty_memory = 0;
+    int64_t pending_flushes = 0;
+    int64_t pending_compactions = 0;
+    double compaction_backlog = 0;
+
+    write_path_stats operator+(const write_path_stats& o) const {
+        return {dirty_memory + o.dirty_memory, pending_flushes + o.pending_flushes,
+                pending_compactions + o.pending_compactions, compaction_backlog + o.compaction_backlog};
+    }
+};
+
+struct sustained_write_result : public perf_result {
+    uint64_t p50_us = 0;
+    uint64_t p99_us = 0;
+    uint64_t p999_us = 0;
+    uint64_t max_us = 0;
+    write_path_stats write_path;
+};
+
+template <> struct fmt::formatter<sustained_write_result> : fmt::formatter<string_view> {
+    auto format(const sustained_write_result& r, fmt::format_context& ctx) const {
+        return fmt::format_to(ctx.out(), "{}, latency p50={}us p99={}us p999={}us max={}us, "
+                "dirty memory={}MB, pending flushes={}, pending compactions={}, compaction backlog={:.0f}",
+                static_cast<const perf_result&>(r), r.p50_us, r.p99_us, r.p999_us, r.max_us,
+                r.write_path.dirty_memory >> 20, r.write_path.pending_flushes, r.write_path.pending_compactions,
+                r.write_path.compaction_backlog);
+    }
+};
+
+static future<> do_sustained_write(cql_test_env& env, cql3::prepared_cache_key_type id, test_config& cfg, sustained_write_state& st) {
+    using clk = sustained_write_state::clk;
+    auto start = clk::now();
+    if (cfg.write_rate) {
+        // Latency is counted from the time the write was due, not from the
+        // time a worker got to it, so that falling behind the target rate
+        // shows up in the percentiles instead of hiding in lower throughput.
+        if (st.next_at == clk::time_point()) {
+            st.next_at = start;
+        }
+        start = std::exchange(st.next_at, st.next_at + std::chrono::duration_cast<clk::duration>(std::chrono::seconds(1)) / cfg.write_rate);
+        auto now = clk::now();
+        if (start > now) {
+            co_await seastar::sleep(start - now);
+        }
+    }
+    bytes key = make_random_key(cfg);
+    co_await env.execute_prepared(id, {{cql3::raw_value::make_value(std::move(key))}}).discard_result();
+    st.latency.add(clk::now() - start);
+}
+
+// Writes with compaction enabled, either as fast as possible or at a fixed
+// rate, and reports write latency together with the state of memtable
+// flushing and compaction every second, so that write stalls can be
+// reproduced and followed over a long run.
+static std::vector<perf_result> test_sustained_write(cql_test_env& env, test_config& cfg) {
+    auto id = env.prepare(make_write_query(cfg)).get();
+    sharded<sustained_write_state> state;
+    state.start().get();
+    auto stop_state = defer([&state] {
+        state.stop().get();
+    });
+    auto report = [&env, &state] (sustained_write_result& r, const executor_shard_stats&) {
+        auto latency = state.map_reduce0([] (sustained_write_state& s) {
+            return std::exchange(s.latency, {});
+        }, utils::time_estimated_histogram(), utils::time_estimated_histogram_merge).get();
+        r.p50_us = latency.quantile(0.5);
+        r.p99_us = latency.quantile(0.99);
+        r.p999_us = latency.quantile(0.999);
+        r.max_us = latency.max();
+        r.write_path = env.db().map_reduce0([] (replica::database& db) {
+            auto& cm = db.get_compaction_manager();
+            return write_path_stats{
+                .dirty_memory = db.dirty_memory_region_group().real_memory_used(),
+                .pending_flushes = db.find_column_family("ks", "cf").get_stats().pending_flushes,
+                .pending_compactions = cm.get_stats().pending_tasks,
+                .compaction_backlog = cm.backlog(),
+            };
+        }, write_path_stats(), std::plus<write_path_stats>()).get();
+    };
+    auto results = time_parallel_ex<sustained_write_result>([&env, &cfg, &state, id] {
+            return do_sustained_write(env, id, cfg, state.local());
+        }, cfg.concurrency, cfg.duration_in_seconds, cfg.operations_per_shard, cfg.stop_on_error, report);
+    return std::vector<perf_result>(results.begin(), results.end());
+}
+
 static std::vector<perf_result> test_delete(cql_test_env& env, test_config& cfg) {
     create_partitions(env, cfg);
     sstring usings;
@@ -434,11 +539,13 @@ static std::vector<perf_result> do_cql_test(cql_test_env& env, test_config& cfg)
                 .build();
     }).get();
 
-    std::cout << "Disabling auto compaction" << std::endl;
-    env.db().invoke_on_all([] (auto& db) {
-        auto& cf = db.find_column_family("ks", "cf");
-        return cf.disable_auto_compaction();
-    }).get();
+    if (!cfg.sustained_write) {
+        std::cout << "Disabling auto compaction" << std::endl;
+        env.db().invoke_on_all([] (auto& db) {
+            auto& cf = db.find_column_family("ks", "cf");
+            return cf.disable_auto_compaction();
+        }).get();
+    }
 
     switch (cfg.mode) {
     case test_config::run_mode::read:
@@ -446,6 +553,8 @@ static std::vector<perf_result> do_cql_test(cql_test_env& env, test_config& cfg)
     case test_config::run_mode::write:
         if (cfg.counters) {
             return test_counter_update(env, cfg);
+        } else if (cfg.sustained_write) {
+            return test_sustained_write(env, cfg);
         } else {
             return test_write(env, cfg);
         }
@@ -492,6 +601,9 @@ void write_json_result(std::string result_file, const test_config& cfg, const ag
     if (cfg.counters) {
         test_type += "_counters";
     }
+    if (cfg.sustained_write) {
+        test_type = "sustained_" + test_type;
+    }
     results["test_properties"]["type"] = test_type;
 
     // <version>-<release>
@@ -545,6 +657,8 @@ int scylla_simple_query_main(int argc, char** argv) {
         ("stop-on-error", bpo::value<bool>()->default_value(true), "stop after encountering the first error")
         ("timeout", bpo::value<std::string>()->default_value(""), "use timeout")
         ("bypass-cache", "use bypass cache when querying")
+        ("sustained-write", "test write path with auto compaction enabled, reporting latency percentiles, dirty memory, flushes and compaction backlog every second")
+        ("write-rate", bpo::value<unsigned>()->default_value(0), "with --sustained-write: target writes per second per shard, 0 to write as fast as possible")
         ;
 
     set_abort_on_internal_error(true);
@@ -579,7 +693,9 @@ int scylla_simple_query_main(int argc, char** argv) {
             if (app.configuration().contains("tablets")) {
                 cfg.initial_tablets = app.configuration()["initial-tablets"].as<unsigned>();
             }
-            if (app.configuration().contains("write")) {
+            cfg.sustained_write = app.configuration().contains("sustained-write");
+            cfg.write_rate = app.configuration()["write-rate"].as<unsigned>();
+            if (app.configuration().contains("write") || cfg.sustained_write) {
                 cfg.mode = test_config::run_mode::write;
             } else if (app.configuration().contains("delete")) {
                 cfg.mode = test_config::run_mode::del;
@@ -591,6 +707,9 @@ int scylla_simple_query_main(int argc, char** argv) {
             } else {
                 cfg.frontend = test_config::frontend_type::cql;
             }
+            if (cfg.sustained_write && (cfg.counters || cfg.frontend != test_config::frontend_type::cql)) {
+                throw std::runtime_error("--sustained-write is supported only with the CQL frontend and without --counters");
+            }
             if (app.configuration().contains("operations-per-shard")) {
                 cfg.operations_per_shard = app.configuration()["operations-per-shard"].as<unsigned>();
             }
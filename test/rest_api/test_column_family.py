@@ -125,3 +125,26 @@ def test_sstables_by_key_reader_closed(cql, this_dc, rest_api):
             with scylla_inject_error(rest_api, "advance_lower_and_check_if_present"):
                 resp = rest_api.send("GET", f"column_family/sstables/by_key/{test_keyspace}:{test_table}?key=1")
                 assert resp.status_code == 500
+
+def test_column_family_cache_hot_keys(cql, this_dc, rest_api):
+    ksdef = f"WITH REPLICATION = {{ 'class' : 'NetworkTopologyStrategy', '{this_dc}' : '1' }}"
+    with new_test_keyspace(cql, ksdef) as test_keyspace:
+        with new_test_table(cql, test_keyspace, "a int, PRIMARY KEY (a)") as t:
+            test_table = t.split('.')[1]
+
+            cql.execute(f"INSERT INTO {test_keyspace}.{test_table} (a) VALUES (1)")
+            resp = rest_api.send("POST", f"storage_service/keyspace_flush/{test_keyspace}")
+            resp.raise_for_status()
+            cql.execute(f"SELECT * FROM {test_keyspace}.{test_table} WHERE a = 1")
+
+            resp = rest_api.send("GET", f"column_family/cache/hot_keys/{test_keyspace}:{test_table}")
+            resp.raise_for_status()
+            keys = resp.json()
+            assert len(keys) == 1
+
+            resp = rest_api.session.post(f"http://{rest_api.host}:{rest_api.port}/column_family/cache/hot_keys/{test_keyspace}:{test_table}", json=keys)
+            resp.raise_for_status()
+
+            # malformed keys are rejected
+            resp = rest_api.session.post(f"http://{rest_api.host}:{rest_api.port}/column_family/cache/hot_keys/{test_keyspace}:{test_table}", json=["zz"])
+            assert resp.status_code == requests.codes.bad_request
@@ -1125,7 +1125,7 @@ void dump_summary_operation(schema_ptr schema, reader_permit permit, const std::
 
         writer.Key("positions");
         writer.StartArray();
-        for (const auto& pos : summary.positions) {
+        for (const auto& pos : summary.positions()) {
             writer.Uint64(pos);
         }
         writer.EndArray();
@@ -71,6 +71,9 @@ namespace cql_transport {
 
 static logging::logger clogger("cql_server");
 
+// How often the shard loads advertised in SUPPORTED are refreshed.
+static constexpr auto shard_load_refresh_interval = std::chrono::seconds(1);
+
 /**
  * Skip registering CQL metrics for these SGs - these are internal scheduling groups that are not supposed to handle CQL
  * requests.
@@ -250,6 +253,14 @@ cql_server::cql_server(distributed<cql3::query_processor>& qp, auth::service& au
 {
     namespace sm = seastar::metrics;
 
+    if (_config.allow_shard_aware_drivers) {
+        _shard_loads.resize(smp::count);
+        if (this_shard_id() == 0) {
+            _shard_load_timer.set_callback([this] { refresh_shard_loads(); });
+            _shard_load_timer.arm(shard_load_refresh_interval);
+        }
+    }
+
     if (used_by_maintenance_socket) {
         return;
     }
@@ -596,6 +607,35 @@ future<foreign_ptr<std::unique_ptr<cql_server::response>>>
     });
 }
 
+void cql_server::refresh_shard_loads() {
+    // Runs in the background on shard 0, stop() waits for it. The other
+    // shards get a copy of the snapshot, so that each refresh costs two
+    // messages per shard instead of a map from every shard.
+    (void)with_gate(_shard_load_gate, [this] {
+        return container().map([] (cql_server& server) {
+            return server.shard_load();
+        }).then([this] (std::vector<uint32_t> shard_loads) {
+            return container().invoke_on_others([shard_loads] (cql_server& server) {
+                server._shard_loads = shard_loads;
+            }).then([this, shard_loads = std::move(shard_loads)] () mutable {
+                _shard_loads = std::move(shard_loads);
+            });
+        });
+    }).handle_exception([] (std::exception_ptr ep) {
+        clogger.debug("Failed to refresh shard loads: {}", ep);
+    }).finally([this] {
+        if (!_shard_load_gate.is_closed()) {
+            _shard_load_timer.arm(shard_load_refresh_interval);
+        }
+    });
+}
+
+future<> cql_server::stop() {
+    _shard_load_timer.cancel();
+    co_await _shard_load_gate.close();
+    co_await generic_server::server::stop();
+}
+
 cql_server::connection::connection(cql_server& server, socket_address server_addr, connected_socket&& fd, socket_address addr)
     : generic_server::connection{server, std::move(fd)}
     , _server(server)
@@ -951,7 +991,7 @@ future<std::unique_ptr<cql_server::response>> cql_server::connection::process_au
 
 future<std::unique_ptr<cql_server::response>> cql_server::connection::process_options(uint16_t stream, request_reader in, service::client_state& client_state,
         tracing::trace_state_ptr trace_state) {
-    return make_ready_future<std::unique_ptr<cql_server::response>>(make_supported(stream, std::move(trace_state)));
+    return make_ready_future<std::unique_ptr<cql_server::response>>(make_supported(stream, std::move(trace_state), _server._shard_loads));
 }
 
 std::unique_ptr<cql_server::response>
@@ -1424,7 +1464,7 @@ std::unique_ptr<cql_server::response> cql_server::connection::make_auth_challeng
     return response;
 }
 
-std::unique_ptr<cql_server::response> cql_server::connection::make_supported(int16_t stream, const tracing::trace_state_ptr& tr_state) const
+std::unique_ptr<cql_server::response> cql_server::connection::make_supported(int16_t stream, const tracing::trace_state_ptr& tr_state, const std::vector<uint32_t>& shard_loads) const
 {
     std::multimap<sstring, sstring> opts;
     opts.insert({"CQL_VERSION", cql3::query_processor::CQL_VERSION});
@@ -1442,6 +1482,7 @@ std::unique_ptr<cql_server::response> cql_server::connection::make_supported(int
         }
         opts.insert({"SCYLLA_SHARDING_IGNORE_MSB", format("{:d}", _server._config.sharding_ignore_msb)});
         opts.insert({"SCYLLA_PARTITIONER", _server._config.partitioner_name});
+        opts.insert({"SCYLLA_SHARD_LOAD", fmt::format("{}", fmt::join(shard_loads, ","))});
     }
     for (cql_protocol_extension ext : supported_cql_protocol_extensions()) {
         const sstring ext_key_name = protocol_extension_name(ext);
@@ -1965,6 +2006,12 @@ void cql_server::response::write(const cql3::metadata& m, bool no_metadata) {
         return;
     }
 
+    if (auto& serialized = m.serialized_names(global_tables_spec)) {
+        _body.write(*serialized);
+        return;
+    }
+    auto names_start = _body.size();
+
     auto names_i = m.get_names().begin();
 
     if (global_tables_spec) {
@@ -1982,6 +2029,17 @@ void cql_server::response::write(const cql3::metadata& m, bool no_metadata) {
         write_string(name->name->text());
         type_codec::encode(*this, name->type);
     }
+
+    bytes serialized(bytes::initialized_later(), _body.size() - names_start);
+    auto out = serialized.begin();
+    size_t skip = names_start;
+    for (bytes_view fragment : _body.fragments()) {
+        auto n = std::min(skip, fragment.size());
+        fragment.remove_prefix(n);
+        skip -= n;
+        out = std::copy(fragment.begin(), fragment.end(), out);
+    }
+    m.set_serialized_names(global_tables_spec, std::move(serialized));
 }
 
 void cql_server::response::write(const cql3::prepared_metadata& m, uint8_t version)
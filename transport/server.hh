@@ -163,6 +163,12 @@ class cql_server : public seastar::peering_sharded_service<cql_server>, public g
     qos::service_level_controller& _sl_controller;
     gms::gossiper& _gossiper;
     scheduling_group_key _stats_key;
+    // The loads of all shards, as advertised in SUPPORTED. Refreshed in
+    // the background by shard 0, which pushes it to the other shards, so
+    // that OPTIONS doesn't have to visit every shard.
+    std::vector<uint32_t> _shard_loads;
+    timer<lowres_clock> _shard_load_timer;
+    seastar::gate _shard_load_gate;
 public:
     cql_server(distributed<cql3::query_processor>& qp, auth::service&,
             service::memory_limiter& ml,
@@ -182,7 +188,16 @@ class cql_server : public seastar::peering_sharded_service<cql_server>, public g
     }
 
     future<utils::chunked_vector<client_data>> get_client_data();
+
+    // Requests being served or waiting for memory on this shard.
+    uint32_t shard_load() const noexcept {
+        return _stats.requests_serving + _memory_available.waiters();
+    }
+
+    future<> stop();
 private:
+    void refresh_shard_loads();
+
     class fmt_visitor;
     friend class connection;
     friend std::unique_ptr<cql_server::response> make_result(int16_t stream, messages::result_message& msg,
@@ -254,7 +269,7 @@ class cql_server : public seastar::peering_sharded_service<cql_server>, public g
         std::unique_ptr<cql_server::response> make_rate_limit_error(int16_t stream, exceptions::exception_code err, sstring msg, db::operation_type op_type, bool rejected_by_coordinator, const tracing::trace_state_ptr& tr_state, const service::client_state& client_state) const;
         std::unique_ptr<cql_server::response> make_error(int16_t stream, exceptions::exception_code err, sstring msg, const tracing::trace_state_ptr& tr_state) const;
         std::unique_ptr<cql_server::response> make_ready(int16_t stream, const tracing::trace_state_ptr& tr_state) const;
-        std::unique_ptr<cql_server::response> make_supported(int16_t stream, const tracing::trace_state_ptr& tr_state) const;
+        std::unique_ptr<cql_server::response> make_supported(int16_t stream, const tracing::trace_state_ptr& tr_state, const std::vector<uint32_t>& shard_loads) const;
         std::unique_ptr<cql_server::response> make_topology_change_event(const cql_transport::event::topology_change& event) const;
         std::unique_ptr<cql_server::response> make_status_change_event(const cql_transport::event::status_change& event) const;
         std::unique_ptr<cql_server::response> make_schema_change_event(const cql_transport::event::schema_change& event) const;
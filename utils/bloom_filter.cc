@@ -50,17 +50,46 @@ bloom_filter::~bloom_filter() noexcept {
 }
 
 bool bloom_filter::is_present(hashed_key key) {
-    bool result = true;
-    for_each_index(key, _hash_count, _bitset.size(), _format, [this, &result] (auto i) {
-        if (!_bitset.test(i)) {
-            result = false;
-            return stop_iteration::yes;
-        }
+    // Probing one bit after another serializes the cache misses of all the
+    // k probes, as each test() has to complete before the next one can be
+    // issued. Instead compute all positions up-front, prefetch the words
+    // holding them and only then test them, so the misses overlap.
+    // Filters with an unusually high hash count (they can come from disk)
+    // fall back to the one-by-one probing.
+    static constexpr int max_batched_hashes = 32;
+    if (_hash_count > max_batched_hashes) [[unlikely]] {
+        bool result = true;
+        for_each_index(key, _hash_count, _bitset.size(), _format, [this, &result] (auto i) {
+            if (!_bitset.test(i)) {
+                result = false;
+                return stop_iteration::yes;
+            }
+            return stop_iteration::no;
+        });
+        return result;
+    }
+
+    std::array<size_t, max_batched_hashes> positions;
+    int n = 0;
+    for_each_index(key, _hash_count, _bitset.size(), _format, [this, &positions, &n] (auto i) {
+        _bitset.prefetch(i);
+        positions[n++] = i;
         return stop_iteration::no;
     });
+    bool result = true;
+    for (int j = 0; j < n; ++j) {
+        result &= _bitset.test(positions[j]);
+    }
     return result;
 }
 
+void bloom_filter::prefetch(hashed_key key) const {
+    for_each_index(key, _hash_count, _bitset.size(), _format, [this] (auto i) {
+        _bitset.prefetch(i);
+        return stop_iteration::no;
+    });
+}
+
 void bloom_filter::add(const bytes_view& key) {
     for_each_index(make_hashed_key(key), _hash_count, _bitset.size(), _format, [this] (auto i) {
         _bitset.set(i);
@@ -44,6 +44,8 @@ class bloom_filter: public i_filter {
 
     virtual bool is_present(hashed_key key) override;
 
+    virtual void prefetch(hashed_key key) const override;
+
     virtual void clear() override {
         _bitset.clear();
     }
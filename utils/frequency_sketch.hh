@@ -0,0 +1,94 @@
+/*
+ * Copyright (C) 2024-present ScyllaDB
+ */
+
+/*
+ * SPDX-License-Identifier: AGPL-3.0-or-later
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <vector>
+
+#include "utils/murmur_hash.hh"
+
+namespace utils {
+
+// An approximate counter of how often keys were seen recently, as used by
+// TinyLFU ("TinyLFU: A Highly Efficient Cache Admission Policy", Einziger,
+// Friedman and Manes, 2017).
+//
+// It is a count-min sketch of 4-bit counters packed 16 to a 64-bit word,
+// with four counters per key. Once the number of recorded accesses reaches
+// ten times the number of counters, all counters are halved, so that the
+// estimates reflect recent history only.
+//
+// Keys are 64-bit hashes; callers should supply well-mixed values.
+class frequency_sketch {
+    static constexpr unsigned max_count = 15;
+    static constexpr uint64_t reset_mask = 0x7777777777777777ull;
+
+    std::vector<uint64_t> _table;
+    uint64_t _mask;
+    uint64_t _sample_size;
+    uint64_t _additions = 0;
+private:
+    static uint64_t rehash(uint64_t key, unsigned i) noexcept {
+        return murmur_hash::fmix(key + i * 0x9e3779b97f4a7c15ull);
+    }
+
+    // Returns the index into _table and the bit offset of the i-th counter of key.
+    std::pair<size_t, unsigned> counter(uint64_t key, unsigned i) const noexcept {
+        auto h = rehash(key, i);
+        return {h & _mask, ((h >> 32) & 15) * 4};
+    }
+
+    void reset() noexcept {
+        for (auto& w : _table) {
+            w = (w >> 1) & reset_mask;
+        }
+        _additions /= 2;
+    }
+public:
+    // The sketch holds 16 * words counters, words is rounded up to a power of two.
+    explicit frequency_sketch(size_t words = 1 << 14)
+        : _table(std::bit_ceil(std::max<size_t>(words, 1)))
+        , _mask(_table.size() - 1)
+        , _sample_size(_table.size() * 16 * 10)
+    { }
+
+    // Records an access to key.
+    void increment(uint64_t key) noexcept {
+        bool added = false;
+        for (unsigned i = 0; i < 4; ++i) {
+            auto [idx, shift] = counter(key, i);
+            if (((_table[idx] >> shift) & max_count) != max_count) {
+                _table[idx] += uint64_t(1) << shift;
+                added = true;
+            }
+        }
+        if (added && ++_additions == _sample_size) {
+            reset();
+        }
+    }
+
+    // Returns the estimated number of recent accesses to key.
+    unsigned frequency(uint64_t key) const noexcept {
+        unsigned ret = max_count;
+        for (unsigned i = 0; i < 4; ++i) {
+            auto [idx, shift] = counter(key, i);
+            ret = std::min<unsigned>(ret, (_table[idx] >> shift) & max_count);
+        }
+        return ret;
+    }
+
+    void clear() noexcept {
+        std::fill(_table.begin(), _table.end(), 0);
+        _additions = 0;
+    }
+};
+
+}
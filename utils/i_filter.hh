@@ -39,6 +39,9 @@ struct i_filter {
     virtual void add(const bytes_view& key) = 0;
     virtual bool is_present(const bytes_view& key) = 0;
     virtual bool is_present(hashed_key) = 0;
+    // Hint that is_present(key) is about to be called, so the filter can
+    // start fetching the memory it will touch. Does nothing by default.
+    virtual void prefetch(hashed_key) const { }
     virtual void clear() = 0;
     virtual void close() = 0;
 
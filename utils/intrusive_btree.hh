@@ -823,6 +823,16 @@ class tree {
                 return nullptr;
             }
         }
+
+        /*
+         * Returns pointer on the owning tree if the element is the
+         * last (rightmost) one in it.
+         */
+        tree_ptr tree_if_last() noexcept {
+            iterator_base next = *this;
+            ++next;
+            return next.is_end() ? next._tree : nullptr;
+        }
     };
 
     using iterator_base_const = iterator_base<true>;
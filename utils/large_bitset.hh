@@ -44,6 +44,11 @@ class large_bitset {
         auto idx2 = idx;
         return (_storage[idx1] >> idx2) & 1;
     }
+    // Hint the CPU to bring in the word holding bit idx, so that several
+    // test() calls on unrelated words can have their cache misses overlap.
+    void prefetch(size_t idx) const {
+        __builtin_prefetch(&_storage[idx / bits_per_int()]);
+    }
     void set(size_t idx) {
         auto idx1 = idx / bits_per_int();
         idx %= bits_per_int();
@@ -404,13 +404,18 @@ class background_reclaimer {
     timer<lowres_clock> _adjust_shares_timer;
     // If engaged, main loop is not running, set_value() to wake it.
     promise<>* _main_loop_wait = nullptr;
+    // The amount of free memory the reclaimer tries to keep ahead of demand,
+    // so that allocations don't have to reclaim synchronously.
+    // Must be initialized before _done, which starts the main loop.
+    size_t _free_memory_threshold;
     future<> _done;
     bool _stopping = false;
-    static constexpr size_t free_memory_threshold = 60'000'000;
+public:
+    static constexpr size_t default_free_memory_threshold = 60'000'000;
 private:
     bool have_work() const {
 #ifndef SEASTAR_DEFAULT_ALLOCATOR
-        return memory::free_memory() < free_memory_threshold;
+        return memory::free_memory() < _free_memory_threshold;
 #else
         return false;
 #endif
@@ -436,14 +441,14 @@ class background_reclaimer {
             if (_stopping) {
                 break;
             }
-            _reclaim(free_memory_threshold - memory::free_memory());
+            _reclaim(_free_memory_threshold - memory::free_memory());
             co_await coroutine::maybe_yield();
         }
         llogger.debug("background_reclaimer::main_loop: exit");
     }
     void adjust_shares() {
         if (have_work()) {
-            auto shares = 1 + (1000 * (free_memory_threshold - memory::free_memory())) / free_memory_threshold;
+            auto shares = 1 + (1000 * (_free_memory_threshold - memory::free_memory())) / _free_memory_threshold;
             _sg.set_shares(shares);
             llogger.trace("background_reclaimer::adjust_shares: {}", shares);
             if (_main_loop_wait) {
@@ -452,10 +457,11 @@ class background_reclaimer {
         }
     }
 public:
-    explicit background_reclaimer(scheduling_group sg, noncopyable_function<void (size_t target)> reclaim)
+    explicit background_reclaimer(scheduling_group sg, size_t free_memory_threshold, noncopyable_function<void (size_t target)> reclaim)
             : _sg(sg)
             , _reclaim(std::move(reclaim))
             , _adjust_shares_timer(default_scheduling_group(), [this] { adjust_shares(); })
+            , _free_memory_threshold(free_memory_threshold)
             , _done(with_scheduling_group(_sg, [this] { return main_loop(); })) {
         if (sg != default_scheduling_group()) {
             _adjust_shares_timer.arm_periodic(50ms);
@@ -539,9 +545,13 @@ class tracker::impl {
     // Abort on allocation failure from LSA
     void enable_abort_on_bad_alloc() noexcept { _abort_on_bad_alloc = true; }
     bool should_abort_on_bad_alloc() const noexcept { return _abort_on_bad_alloc; }
-    void setup_background_reclaim(scheduling_group sg) {
+    void setup_background_reclaim(scheduling_group sg, size_t free_memory_threshold) {
         assert(!_background_reclaimer);
-        _background_reclaimer.emplace(sg, [this] (size_t target) {
+        if (!free_memory_threshold) {
+            free_memory_threshold = background_reclaimer::default_free_memory_threshold;
+        }
+        llogger.debug("background reclaim keeps {} bytes free", free_memory_threshold);
+        _background_reclaimer.emplace(sg, free_memory_threshold, [this] (size_t target) {
             reclaim(target, is_preemptible::yes);
         });
     }
@@ -791,17 +801,31 @@ class standard_memory_segment_store_backend : public segment_store_backend {
     size_t _available_segments; // for fast free_memory()
 
 private:
+    // Transparent huge pages can only back naturally aligned ranges, so align
+    // the area to a huge page. Otherwise, the first and last segments
+    // sharing a huge page with the unaligned ends would be backed by small
+    // pages, as would be all of them if the area started in the middle of
+    // a huge page.
+    static constexpr size_t huge_page_size = 2 << 20;
+
     static memory::memory_layout allocate_memory(size_t segments) {
         const auto size = segments * segment_size;
-        auto p = mmap(nullptr, size,
+        auto p = mmap(nullptr, size + huge_page_size,
                 PROT_READ | PROT_WRITE,
                 MAP_PRIVATE | MAP_ANONYMOUS,
                 -1, 0);
         if (p == MAP_FAILED) {
             std::abort();
         }
-        madvise(p, size, MADV_HUGEPAGE);
-        auto start = reinterpret_cast<uintptr_t>(p);
+        auto mapped = reinterpret_cast<uintptr_t>(p);
+        auto start = align_up(mapped, uintptr_t(huge_page_size));
+        if (start != mapped) {
+            munmap(p, start - mapped);
+        }
+        if (auto tail = mapped + size + huge_page_size - (start + size)) {
+            munmap(reinterpret_cast<void*>(start + size), tail);
+        }
+        madvise(reinterpret_cast<void*>(start), size, MADV_HUGEPAGE);
         return {start, start + size};
     }
 public:
@@ -2425,7 +2449,7 @@ void tracker::configure(const config& cfg) {
     if (cfg.abort_on_lsa_bad_alloc) {
         _impl->enable_abort_on_bad_alloc();
     }
-    _impl->setup_background_reclaim(cfg.background_reclaim_sched_group);
+    _impl->setup_background_reclaim(cfg.background_reclaim_sched_group, cfg.background_reclaim_free_memory_threshold);
     _impl->set_sanitizer_report_backtrace(cfg.sanitizer_report_backtrace);
 }
 
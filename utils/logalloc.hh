@@ -64,6 +64,8 @@ class tracker {
         bool sanitizer_report_backtrace = false; // Better reports but slower
         size_t lsa_reclamation_step;
         scheduling_group background_reclaim_sched_group;
+        // Amount of free memory the background reclaimer maintains, 0 means the default (60MB).
+        size_t background_reclaim_free_memory_threshold = 0;
     };
 
     struct stats {
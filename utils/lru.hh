@@ -124,6 +124,13 @@ class lru {
         add(e);
     }
 
+    // Returns the element evicted right before e in the absence of later
+    // touches, or nullptr if e is the least recently used one.
+    evictable* less_recent(evictable& e) noexcept {
+        auto i = _list.iterator_to(e);
+        return i == _list.begin() ? nullptr : &*std::prev(i);
+    }
+
     // Evicts a single element from the LRU
     template <bool Shallow = false>
     reclaiming_result do_evict(bool should_evict_index) noexcept {
@@ -17,16 +17,123 @@
 #include "exceptions/exceptions.hh"
 #include "utils/class_registrator.hh"
 #include "utils/reusable_buffer.hh"
+#include "utils/base64.hh"
+#include <seastar/core/shared_ptr.hh>
+#include <seastar/core/weak_ptr.hh>
 #include <concepts>
+#include <map>
+#include <unordered_map>
 
 static const sstring COMPRESSION_LEVEL = "compression_level";
+// A base64-encoded zstd dictionary (e.g. the output of `zstd --train`),
+// used to compress and decompress every chunk. With small chunks most of
+// the input is too short for zstd to find repetitions in it, a dictionary
+// trained on representative data makes up for that.
+// The option is persisted in CompressionInfo with the other compressor
+// options, so each sstable carries the dictionary it needs to be read.
+// In memory, compressors using the same dictionary share it, see
+// zstd_dictionary.
+static const sstring DICTIONARY = "dictionary";
+// CompressionInfo stores option values with a 16-bit length, the base64
+// encoding of the dictionary has to fit.
+static constexpr size_t MAX_DICTIONARY_SIZE = 32 * 1024;
 static const sstring COMPRESSOR_NAME = compressor::namespace_prefix + "ZstdCompressor";
 static const size_t DCTX_SIZE = ZSTD_estimateDCtxSize();
 
+struct cdict_deleter {
+    void operator()(ZSTD_CDict* d) const noexcept { ZSTD_freeCDict(d); }
+};
+struct ddict_deleter {
+    void operator()(ZSTD_DDict* d) const noexcept { ZSTD_freeDDict(d); }
+};
+
+// A decoded zstd dictionary and the zstd objects digested from it.
+//
+// Every sstable creates its own compressor from the options stored in its
+// CompressionInfo, and a table's sstables usually all use the same
+// dictionary. So dictionaries are interned per shard by their encoded
+// form: compressors using the same dictionary share one decoded copy, one
+// decompression dictionary and one compression dictionary per set of
+// compression parameters.
+class zstd_dictionary : public enable_lw_shared_from_this<zstd_dictionary>, public weakly_referencable<zstd_dictionary> {
+    sstring _encoded;
+    bytes _raw;
+    // References _raw instead of copying it.
+    std::unique_ptr<ZSTD_DDict, ddict_deleter> _ddict;
+    // The compression dictionaries are much bigger and depend on the
+    // compression parameters, which in turn depend on the level and
+    // chunk length. They are only needed when writing, so they are created
+    // on first use.
+    std::map<std::pair<int, size_t>, std::unique_ptr<ZSTD_CDict, cdict_deleter>> _cdicts;
+public:
+    zstd_dictionary(sstring encoded, bytes raw);
+
+    const sstring& encoded() const noexcept { return _encoded; }
+    size_t size() const noexcept { return _raw.size(); }
+    const ZSTD_DDict* ddict() const noexcept { return _ddict.get(); }
+    const ZSTD_CDict* cdict(int level, size_t chunk_len, const ZSTD_compressionParameters& cparams);
+
+    // Returns the dictionary with the given base64 encoding, shared with
+    // the other users of the same dictionary on this shard.
+    static lw_shared_ptr<zstd_dictionary> get(const sstring& encoded);
+};
+
+zstd_dictionary::zstd_dictionary(sstring encoded, bytes raw)
+    : _encoded(std::move(encoded))
+    , _raw(std::move(raw))
+    , _ddict(ZSTD_createDDict_byReference(_raw.data(), _raw.size()))
+{
+    if (!_ddict) {
+        throw exceptions::configuration_exception(format("Invalid zstd dictionary in {}", DICTIONARY));
+    }
+}
+
+const ZSTD_CDict* zstd_dictionary::cdict(int level, size_t chunk_len, const ZSTD_compressionParameters& cparams) {
+    auto& cdict = _cdicts[{level, chunk_len}];
+    if (!cdict) {
+        // Using the same parameters the compression context was sized
+        // for, so that it can hold the dictionary state.
+        cdict.reset(ZSTD_createCDict_advanced(_raw.data(), _raw.size(),
+                ZSTD_dlm_byRef, ZSTD_dct_auto, cparams, ZSTD_defaultCMem));
+        if (!cdict) {
+            throw std::runtime_error("Unable to create ZSTD compression dictionary");
+        }
+    }
+    return cdict.get();
+}
+
+lw_shared_ptr<zstd_dictionary> zstd_dictionary::get(const sstring& encoded) {
+    // Compressors may outlive this map at shard exit, so it only holds weak
+    // references and is cleaned of dead entries when a dictionary is added.
+    static thread_local std::unordered_map<sstring, weak_ptr<zstd_dictionary>> dictionaries;
+    if (auto it = dictionaries.find(encoded); it != dictionaries.end() && it->second) {
+        return it->second->shared_from_this();
+    }
+    bytes raw;
+    try {
+        raw = base64_decode(encoded);
+    } catch (const std::exception& e) {
+        throw exceptions::configuration_exception(format("Invalid base64 value for {}: {}", DICTIONARY, e.what()));
+    }
+    if (raw.size() > MAX_DICTIONARY_SIZE) {
+        throw exceptions::configuration_exception(
+            format("{} must be at most {} bytes long, got {}", DICTIONARY, MAX_DICTIONARY_SIZE, raw.size()));
+    }
+    auto dict = make_lw_shared<zstd_dictionary>(encoded, std::move(raw));
+    std::erase_if(dictionaries, [] (const auto& e) { return !e.second; });
+    dictionaries.insert_or_assign(encoded, dict->weak_from_this());
+    return dict;
+}
+
 class zstd_processor : public compressor {
     int _compression_level = 3;
+    size_t _chunk_len;
     size_t _cctx_size;
 
+    // Null when no dictionary is used.
+    lw_shared_ptr<zstd_dictionary> _dictionary;
+    ZSTD_compressionParameters _cparams;
+
     static auto with_dctx(std::invocable<ZSTD_DCtx*> auto f) {
         // The decompression context has a fixed size of ~128 KiB,
         // so we don't bother ever resizing it the way we do with
@@ -83,6 +190,7 @@ class zstd_processor : public compressor {
 
     std::set<sstring> option_names() const override;
     std::map<sstring, sstring> options() const override;
+    bool uncompress_depends_on_options() const override;
 };
 
 zstd_processor::zstd_processor(const opt_getter& opts)
@@ -113,14 +221,24 @@ zstd_processor::zstd_processor(const opt_getter& opts)
        ? std::stoi(*chunk_len_kb) * 1024
        : compression_parameters::DEFAULT_CHUNK_LENGTH;
 
+    _chunk_len = chunk_len;
+
+    auto dictionary = opts(DICTIONARY);
+    if (dictionary && !dictionary->empty()) {
+        _dictionary = zstd_dictionary::get(*dictionary);
+    }
+
     // We assume that the uncompressed input length is always <= chunk_len.
-    auto cparams = ZSTD_getCParams(_compression_level, chunk_len, 0);
-    _cctx_size = ZSTD_estimateCCtxSize_usingCParams(cparams);
+    _cparams = ZSTD_getCParams(_compression_level, chunk_len, _dictionary ? _dictionary->size() : 0);
+    _cctx_size = ZSTD_estimateCCtxSize_usingCParams(_cparams);
 
 }
 
 size_t zstd_processor::uncompress(const char* input, size_t input_len, char* output, size_t output_len) const {
     auto ret = with_dctx([&] (ZSTD_DCtx* dctx) {
+        if (_dictionary) {
+            return ZSTD_decompress_usingDDict(dctx, output, output_len, input, input_len, _dictionary->ddict());
+        }
         return ZSTD_decompressDCtx(dctx, output, output_len, input, input_len);
     });
     if (ZSTD_isError(ret)) {
@@ -132,6 +250,10 @@ size_t zstd_processor::uncompress(const char* input, size_t input_len, char* out
 
 size_t zstd_processor::compress(const char* input, size_t input_len, char* output, size_t output_len) const {
     auto ret = with_cctx(_cctx_size, [&] (ZSTD_CCtx* cctx) {
+        if (_dictionary) {
+            return ZSTD_compress_usingCDict(cctx, output, output_len, input, input_len,
+                    _dictionary->cdict(_compression_level, _chunk_len, _cparams));
+        }
         return ZSTD_compressCCtx(cctx, output, output_len, input, input_len, _compression_level);
     });
     if (ZSTD_isError(ret)) {
@@ -145,11 +267,20 @@ size_t zstd_processor::compress_max_size(size_t input_len) const {
 }
 
 std::set<sstring> zstd_processor::option_names() const {
-    return {COMPRESSION_LEVEL};
+    return {COMPRESSION_LEVEL, DICTIONARY};
 }
 
 std::map<sstring, sstring> zstd_processor::options() const {
-    return {{COMPRESSION_LEVEL, std::to_string(_compression_level)}};
+    std::map<sstring, sstring> opts{{COMPRESSION_LEVEL, std::to_string(_compression_level)}};
+    if (_dictionary) {
+        opts.emplace(DICTIONARY, _dictionary->encoded());
+    }
+    return opts;
+}
+
+bool zstd_processor::uncompress_depends_on_options() const {
+    // The compression level only matters for compression.
+    return bool(_dictionary);
 }
 
 static const class_registrator<compressor, zstd_processor, const compressor::opt_getter&>